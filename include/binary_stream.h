@@ -0,0 +1,170 @@
+#ifndef BINARY_STREAM_H
+#define BINARY_STREAM_H
+
+// STL Libs
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Writes trivially copyable values, arrays and strings in native byte order.
+ *
+ */
+class BinaryWriter {
+    std::ofstream m_file {};
+    uint64_t m_size {};
+
+public:
+    BinaryWriter(const std::string& t_fileName);
+    ~BinaryWriter() = default;
+
+    /**
+     * @brief Checks if the file is opened and all writes succeeded.
+     *
+     * @return true - file is good.
+     * @return false - file can not be opened or written.
+     */
+    bool isGood() const;
+
+    /**
+     * @brief Gets the number of bytes written to the file, it is the offset of the next write.
+     *
+     * @return uint64_t - number of bytes.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Writes one value.
+     *
+     * @param t_value value to write.
+     */
+    template <typename T>
+    void write(const T& t_value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_file.write(reinterpret_cast<const char*>(&t_value), sizeof(T));
+        m_size += sizeof(T);
+    }
+
+    /**
+     * @brief Writes size of the array and its values.
+     *
+     * @param t_values values to write.
+     */
+    template <typename T>
+    void writeArray(const std::vector<T>& t_values)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        write<uint64_t>(t_values.size());
+        m_file.write(reinterpret_cast<const char*>(t_values.data()), t_values.size() * sizeof(T));
+        m_size += t_values.size() * sizeof(T);
+    }
+
+    /**
+     * @brief Writes values without their size.
+     *
+     * @param t_values pointer to the first value.
+     * @param t_size number of values.
+     */
+    template <typename T>
+    void writeValues(const T* t_values, const uint64_t& t_size)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        m_file.write(reinterpret_cast<const char*>(t_values), t_size * sizeof(T));
+        m_size += t_size * sizeof(T);
+    }
+
+    /**
+     * @brief Writes size of the string and its characters.
+     *
+     * @param t_string string to write.
+     */
+    void writeString(const std::string_view& t_string);
+
+    /**
+     * @brief Flushes and closes the file.
+     *
+     * @return true - all data is written.
+     * @return false - file can not be written.
+     */
+    bool close();
+};
+
+/**
+ * @brief Reads values written by BinaryWriter from memory, every read is checked against the end of the buffer.
+ *
+ */
+class BinaryReader {
+    std::string_view m_buffer {};
+    uint64_t m_position {};
+
+public:
+    BinaryReader(const std::string_view& t_buffer);
+    ~BinaryReader() = default;
+
+    /**
+     * @brief Reads one value.
+     *
+     * @return T - read value.
+     */
+    template <typename T>
+    T read()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value {};
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+
+        return value;
+    }
+
+    /**
+     * @brief Reads the array written by BinaryWriter::writeArray.
+     *
+     * @return std::vector<T> - read values.
+     */
+    template <typename T>
+    std::vector<T> readArray()
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        uint64_t size = read<uint64_t>();
+
+        if (size > (m_buffer.size() - m_position) / sizeof(T))
+            throw std::runtime_error("Unexpected end of binary data");
+
+        std::vector<T> values(size);
+        std::memcpy(values.data(), take(size * sizeof(T)), size * sizeof(T));
+
+        return values;
+    }
+
+    /**
+     * @brief Reads the string written by BinaryWriter::writeString.
+     *
+     * @return std::string_view - view of the string in the buffer.
+     */
+    std::string_view readString();
+
+    /**
+     * @brief Checks if all data is read.
+     *
+     * @return true - position is at the end of the buffer.
+     * @return false - there is unread data.
+     */
+    bool isEnd() const;
+
+private:
+    /**
+     * @brief Moves the position forward.
+     *
+     * @param t_size number of bytes to take.
+     * @return const char* - pointer to the taken bytes.
+     */
+    const char* take(const uint64_t& t_size);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef BUFFERED_WRITER_H
+#define BUFFERED_WRITER_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Types
+#include "types.h"
+
+/**
+ * @brief Text file writer formatting values with std::to_chars straight into a large buffer, the buffer is written to
+ * the file only when it is full. The buffer is kept between files, so one writer can be reused for all fakes.
+ *
+ */
+class BufferedWriter {
+    std::ofstream m_file {};
+    std::vector<char> m_buffer {};
+    uint64_t m_size {};
+    uint64_t m_totalLines {};
+    uint64_t m_fileSize {};
+
+public:
+    BufferedWriter(const uint64_t& t_capacity = 1 << 20);
+    ~BufferedWriter();
+
+    /**
+     * @brief Opens the file to write to, the previous file is closed.
+     *
+     * @param t_fileName path to the file.
+     * @return true - file is opened.
+     * @return false - file can not be opened.
+     */
+    bool open(const std::string& t_fileName);
+
+    /**
+     * @brief Writes the rest of the buffer and closes the file.
+     *
+     * @return uint64_t - number of lines written to the file.
+     */
+    uint64_t close();
+
+    /**
+     * @brief Gets the number of characters written to the last opened file.
+     *
+     * @return uint64_t - number of characters.
+     */
+    uint64_t fileSize() const;
+
+    /**
+     * @brief Writes the string.
+     *
+     * @param t_string string to write.
+     */
+    void write(const std::string_view& t_string);
+
+    /**
+     * @brief Writes the character, new line characters are counted as lines.
+     *
+     * @param t_character character to write.
+     */
+    void write(const char& t_character);
+
+    /**
+     * @brief Writes the unsigned integer.
+     *
+     * @param t_value value to write.
+     */
+    void writeUnsigned(const uint64_t& t_value);
+
+    /**
+     * @brief Writes the value with fixed precision, same as std::fixed and std::setprecision.
+     *
+     * @param t_value value to write.
+     * @param t_precision number of digits after the decimal point.
+     */
+    void writeFixed(const Value& t_value, const int& t_precision);
+
+    /**
+     * @brief Writes the value in scientific format, same as std::scientific and std::setprecision.
+     *
+     * @param t_value value to write.
+     * @param t_precision number of digits after the decimal point.
+     */
+    void writeScientific(const Value& t_value, const int& t_precision);
+
+    /**
+     * @brief Writes the name of the node. Name format: n1_m[layer]_[x]_[y].
+     *
+     * @param t_nodeCoords metal layer and coordinates of the node.
+     */
+    void writeNodeName(const NodeCoords& t_nodeCoords);
+
+private:
+    /**
+     * @brief Makes room for the given number of characters in the buffer.
+     *
+     * @param t_size number of characters.
+     */
+    void reserve(const uint64_t& t_size);
+
+    /**
+     * @brief Writes the buffer to the file.
+     *
+     */
+    void flush();
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef CANDIDATE_POOL_H
+#define CANDIDATE_POOL_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+/**
+ * @brief Set of indexes below the capacity with constant time insert, erase and random pick. Indexes are stored
+ * densely, erase moves the last index into the gap, so the order of indexes changes. Erased indexes are logged, so
+ * erases made after a mark can be rolled back in reverse, restoring the exact order of the pool.
+ *
+ */
+class CandidatePool {
+public:
+    // Position of indexes which are not in the pool
+    constexpr static uint64_t NO_POSITION = std::numeric_limits<uint64_t>::max();
+
+private:
+    std::vector<uint64_t> m_indexes {};
+    std::vector<uint64_t> m_positions {};
+    std::vector<std::array<uint64_t, 2>> m_erased {};
+
+public:
+    CandidatePool() = default;
+    ~CandidatePool() = default;
+
+    /**
+     * @brief Removes all indexes and marks and sets the capacity.
+     *
+     * @param t_capacity number of possible indexes.
+     */
+    void reset(const uint64_t& t_capacity);
+
+    /**
+     * @brief Gets the number of indexes in the pool.
+     *
+     * @return uint64_t - number of indexes.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Checks if the pool has the index.
+     *
+     * @param t_index index to check.
+     * @return true - index is in the pool.
+     * @return false - index is not in the pool or above the capacity.
+     */
+    bool contains(const uint64_t& t_index) const;
+
+    /**
+     * @brief Adds the index to the pool, the capacity grows if needed.
+     *
+     * @param t_index index to add.
+     */
+    void insert(const uint64_t& t_index);
+
+    /**
+     * @brief Removes the index from the pool if it is there.
+     *
+     * @param t_index index to remove.
+     */
+    void erase(const uint64_t& t_index);
+
+    /**
+     * @brief Marks the current state of the pool to roll back to.
+     *
+     * @return uint64_t - mark of the pool.
+     */
+    uint64_t mark() const;
+
+    /**
+     * @brief Rolls back erases made after the mark in time proportional to their number. The mark is valid until
+     * reset or rollback to an earlier mark, and only if no index is inserted after it.
+     *
+     * @param t_mark mark of the pool.
+     */
+    void rollback(const uint64_t& t_mark);
+
+    /**
+     * @brief Picks a uniformly random index of the pool. The pool must not be empty.
+     *
+     * @param t_generator random number generator.
+     * @return uint64_t - picked index.
+     */
+    uint64_t pick(std::mt19937& t_generator) const;
+};
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef CHOLESKY_SOLVER_H
+#define CHOLESKY_SOLVER_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+
+/**
+ * @brief Direct solver of the conductance matrix with sparse cholesky factorization.
+ *
+ * The matrix is reordered by minimum degree and factored once on construction, every solve is a forward and a
+ * backward substitution. The matrix must not change its conductances afterwards. Solves do not modify the solver, so
+ * one factorization can be shared between threads.
+ */
+class CholeskySolver {
+    std::vector<uint64_t> m_permutation {};
+    std::vector<uint64_t> m_inversePermutation {};
+    std::vector<uint64_t> m_factorOffsets {};
+    std::vector<uint64_t> m_factorRows {};
+    std::vector<Value> m_factorValues {};
+
+public:
+    CholeskySolver() = default;
+    ~CholeskySolver() = default;
+    CholeskySolver(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Solves the matrix with the cached factorization.
+     *
+     * @param t_matrix matrix to solve.
+     * @param t_state currents of the rows, the solution is written to its values.
+     * @param t_residual relative residual norm of the solution.
+     * @return uint64_t - number of substitutions, always 1.
+     */
+    uint64_t solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, Value& t_residual) const;
+
+    /**
+     * @brief Gets the number of non zero values of the factor.
+     *
+     * @return uint64_t - number of non zero values.
+     */
+    uint64_t factorSize() const;
+
+private:
+    /**
+     * @brief Orders rows of the matrix by minimum degree of the elimination graph.
+     *
+     * @param t_matrix matrix to order.
+     */
+    void orderMinimumDegree(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Calculates symbolic and numeric factorization of the permuted matrix.
+     *
+     * @param t_matrix matrix to factor.
+     */
+    void factor(const ConductanceMatrix& t_matrix);
+};
+
+#endif
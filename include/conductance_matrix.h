@@ -0,0 +1,184 @@
+#ifndef CONDUCTANCE_MATRIX_H
+#define CONDUCTANCE_MATRIX_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "thread_pool.h"
+
+// Row index of the node which is not a part of the system (voltage node).
+constexpr static uint64_t NO_ROW = std::numeric_limits<uint64_t>::max();
+
+/**
+ * @brief Mutable part of the conductance system: currents of the rows and the solution.
+ *
+ * The matrix itself is immutable after it is built, so it can be shared between generators while every generator
+ * owns its own state.
+ */
+/**
+ * @brief Work vectors of every level of the multigrid hierarchy, kept in the state between solves.
+ *
+ */
+struct MultigridWorkspace {
+    std::vector<std::vector<Value>> solutions {};
+    std::vector<std::vector<Value>> rightHandSides {};
+    std::vector<std::vector<Value>> residuals {};
+};
+
+struct ConductanceState {
+    std::vector<Value> values {};
+    std::vector<Value> currents {};
+    std::vector<uint64_t> currentRows {};
+    std::vector<uint64_t> changedRows {};
+    std::vector<Value> previousCurrents {};
+    std::vector<Value> residuals {};
+    std::vector<uint64_t> rowQueue {};
+    std::vector<uint8_t> isRowQueued {};
+    uint64_t queuedRowsSize {};
+    std::vector<Value> couplings {};
+    std::vector<Value> workResiduals {};
+    std::vector<Value> workPreconditioned {};
+    std::vector<Value> workDirections {};
+    std::vector<Value> workProducts {};
+    MultigridWorkspace multigridWorkspace {};
+    bool isSolved {};
+};
+
+/**
+ * @brief Nodal conductance system of the pdn in compressed sparse row format.
+ *
+ * Rows are the nodes not driven by voltage sources, voltage nodes are folded into the fixed currents of their
+ * neighbors. Row i solves: diagonal[i] * v[i] - sum(conductances[k] * v[columnIndices[k]]) = fixedCurrents[i] - currents[i].
+ *
+ * Rows of every color are also stored in slices of SLICE_ROWS rows for vector kernels. Entries of a slice are stored
+ * by their position in the row, so one vector holds the same entry of all rows of the slice, shorter rows are padded
+ * by zero conductances to themselves.
+ */
+class ConductanceMatrix {
+public:
+    // Rows of one slice, one row per lane of the widest vector
+    constexpr static uint64_t SLICE_ROWS = 8;
+
+    std::vector<Value> diagonal {};
+    std::vector<Value> inverseDiagonal {};
+    std::vector<Value> fixedCurrents {};
+    std::vector<uint64_t> rowOffsets {};
+    std::vector<uint64_t> columnIndices {};
+    std::vector<Value> conductances {};
+    std::vector<uint64_t> rowNodes {};
+    std::vector<uint64_t> nodeRows {};
+    std::vector<uint64_t> colorOffsets {};
+    std::vector<uint64_t> colorRows {};
+    std::vector<uint64_t> sliceColorOffsets {};
+    std::vector<uint64_t> sliceRowOffsets {};
+    std::vector<uint64_t> sliceRows {};
+    std::vector<uint64_t> sliceEntryOffsets {};
+    std::vector<uint64_t> sliceColumns {};
+    std::vector<Value> sliceConductances {};
+
+public:
+    ConductanceMatrix() = default;
+    ~ConductanceMatrix() = default;
+
+    /**
+     * @brief Gets the number of rows of the system.
+     *
+     * @return uint64_t - number of rows.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Makes one in-place gauss-seidel sweep over rows from the first one.
+     *
+     * @param t_state currents and values of the rows.
+     * @param t_precision max change of the row value to count it as solved.
+     * @param t_rowBegin first row of the sweep.
+     * @return uint64_t - number of solved rows.
+     */
+    uint64_t stepGaussSeidel(ConductanceState& t_state, const Value& t_precision, const uint64_t& t_rowBegin = 0) const;
+
+    /**
+     * @brief Makes one gauss-seidel sweep color by color, rows of the same color are relaxed in parallel.
+     *
+     * @param t_state currents and values of the rows.
+     * @param t_precision max change of the row value to count it as solved.
+     * @param t_threadPool threads to relax rows with.
+     * @return uint64_t - number of solved rows.
+     */
+    uint64_t stepMulticolorGaussSeidel(ConductanceState& t_state, const Value& t_precision, ThreadPool& t_threadPool) const;
+
+    /**
+     * @brief Relaxes only rows whose residual change exceeds the precision, starting from rows with changed currents
+     * and spreading to their neighbors. Residuals of other rows are kept from the previous solve. Rows still queued when
+     * the max number of relaxations is reached stay first in the queue of the state for the next solve.
+     *
+     * @param t_state currents, values and residuals of the rows.
+     * @param t_precision max change of the row value to count it as solved.
+     * @param t_maxRelaxations max number of row relaxations.
+     * @return uint64_t - number of row relaxations.
+     */
+    uint64_t relaxLocal(ConductanceState& t_state, const Value& t_precision, const uint64_t& t_maxRelaxations) const;
+
+    /**
+     * @brief Greedily colors rows so that no two connected rows share a color.
+     *
+     */
+    void buildColors();
+
+    /**
+     * @brief Stores rows of every color in slices, colors must be built. Slices do not cross colors, the last slice
+     * of a color may hold fewer rows and repeats its first row in the rest of lanes.
+     *
+     */
+    void buildSlices();
+
+    /**
+     * @brief Measures how far values of neighbors are from the value of the row, a sweep over rows reads neighbors out
+     * of the window of recently read rows from memory instead of the cache.
+     *
+     * @param t_windowRows number of rows whose values fit the cache.
+     * @return std::array<Value, 2> - mean distance to neighbors in rows and the fraction of neighbors out of the window.
+     */
+    std::array<Value, 2> calculateLocality(const uint64_t& t_windowRows) const;
+
+    /**
+     * @brief Multiplies the matrix by the vector.
+     *
+     * @param t_vector vector to multiply, one value per row.
+     * @param t_result result of multiplication.
+     */
+    void multiply(const std::vector<Value>& t_vector, std::vector<Value>& t_result) const;
+
+    /**
+     * @brief Calculates the residual of current values: fixedCurrents - currents - A * values.
+     *
+     * @param t_state currents and values of the rows.
+     * @param t_residual residual of every row.
+     */
+    void residual(const ConductanceState& t_state, std::vector<Value>& t_residual) const;
+
+    /**
+     * @brief Creates the state of the system with every row set to the value.
+     *
+     * @param t_value initial value of the rows.
+     * @return ConductanceState - state of the system.
+     */
+    ConductanceState createState(const Value& t_value) const;
+
+    /**
+     * @brief Clears the system.
+     *
+     */
+    void clear();
+};
+
+#endif
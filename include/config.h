@@ -5,13 +5,34 @@
 
 struct Config {
     bool isHelp {};
+    bool isSeed {};
+    bool isCached { true };
+    bool isDelta {};
+    bool isExtract {};
+    bool isVerified {};
+    bool isGuided {};
+    bool isBenchmark {};
     uint8_t mode { 1 };
     uint16_t numOfFakes { 10 };
+    uint64_t threads { 1 };
+    uint64_t jobs {};
+    uint16_t writers { 1 };
+    uint16_t writeQueue { 2 };
+    uint8_t archive {};
+    uint32_t mapBin {};
     uint32_t maxIterations { 100000 };
+    uint64_t seed {};
+    uint64_t extractIndex {};
     float irDropDiff { 0.75 };
+    float tolerance { 0.1 };
     double irDropPrecision { 1e-8 };
     std::string source { "./netlist.sp" };
     std::string destination { "./" };
+    std::string solver { "gs" };
+    std::string preconditioner { "jacobi" };
+    std::string ordering { "netlist" };
+    std::string simd { "auto" };
+    std::string workingPrecision { "double" };
 
     Config(const int& args, const char* argv[]);
 };
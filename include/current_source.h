@@ -15,7 +15,8 @@ class CurrentSource {
 public:
     Value value {};
     Name name {};
-    NodePtr connectedNode;
+    // Id of the node the current source is connected to
+    uint64_t connectedNode {};
 
 private:
     L m_layer {};
@@ -29,6 +30,13 @@ public:
 
     void setNewCoords(const NodeCoords& t_node);
 
+    /**
+     * @brief Gets coordinates of the node the current source is connected to.
+     *
+     * @return NodeCoords - node coordinates.
+     */
+    NodeCoords getCoordinates() const;
+
     /**
      * @brief Creates line description of the current source in spice format.
      *
@@ -37,10 +45,11 @@ public:
     std::string toString();
 
     /**
-     * @brief Disconnects the current source from all other elements.
+     * @brief Writes line description of the current source in spice format, same as toString.
      *
+     * @param t_writer writer to write to.
      */
-    void fullyDisconnection();
+    void write(BufferedWriter& t_writer) const;
 };
 
 #endif
\ No newline at end of file
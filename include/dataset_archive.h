@@ -0,0 +1,134 @@
+#ifndef DATASET_ARCHIVE_H
+#define DATASET_ARCHIVE_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "binary_stream.h"
+#include "mapped_file.h"
+#include "pdn_snapshot.h"
+
+/**
+ * @brief Position of one fake in the archive.
+ *
+ */
+struct ArchiveEntry {
+    uint64_t fakeIndex {};
+    uint64_t offset {};
+    uint64_t size {};
+};
+
+/**
+ * @brief Fake read from the archive.
+ *
+ */
+struct ArchiveFake {
+    uint64_t fakeIndex {};
+    std::vector<CurrentSource> currentSources {};
+    std::vector<Value> irDrops {};
+};
+
+/**
+ * @brief Appends fakes of one run to a single binary file. The header holds coordinates of the nodes, every record
+ * holds current sources of the fake and the ir-drop of the nodes as raw float32 or float64 array, and the index of
+ * record offsets is written at the end of the file on close. Records are appended in the order they are written, so
+ * writers of any thread can append.
+ *
+ */
+class DatasetArchiveWriter {
+    BinaryWriter m_writer;
+    std::vector<ArchiveEntry> m_index {};
+    std::mutex m_mutex {};
+    bool m_isSinglePrecision {};
+    bool m_isClosed {};
+
+public:
+    DatasetArchiveWriter(const std::string& t_fileName, const PDNTopology& t_topology, const uint8_t& t_mode,
+        const bool& t_isSinglePrecision);
+    ~DatasetArchiveWriter();
+
+    /**
+     * @brief Appends the fake of the snapshot to the archive.
+     *
+     * @param t_snapshot snapshot of the fake.
+     * @return uint64_t - size of the record in bytes.
+     */
+    uint64_t append(const PDNSnapshot& t_snapshot);
+
+    /**
+     * @brief Writes the index of records and closes the file.
+     *
+     * @return true - whole archive is written.
+     * @return false - file can not be written.
+     */
+    bool close();
+};
+
+/**
+ * @brief Random access to fakes of the archive by their index, the archive is mapped and only the read record is
+ * touched.
+ *
+ */
+class DatasetArchiveReader {
+    MappedFile m_file;
+    uint8_t m_mode {};
+    bool m_isSinglePrecision {};
+    std::shared_ptr<PDNTopology> m_topology {};
+    std::vector<ArchiveEntry> m_index {};
+
+public:
+    DatasetArchiveReader(const std::string& t_fileName);
+    ~DatasetArchiveReader() = default;
+
+    /**
+     * @brief Gets the number of fakes in the archive.
+     *
+     * @return uint64_t - number of fakes.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Gets the mode of the generator the fakes are made with.
+     *
+     * @return uint8_t - mode of the generator.
+     */
+    uint8_t getMode() const;
+
+    /**
+     * @brief Gets coordinates of the nodes, ir-drop values of every fake go in the same order.
+     *
+     * @return std::vector<NodeCoords> - coordinates of the nodes.
+     */
+    std::vector<NodeCoords> getNodeCoords() const;
+
+    /**
+     * @brief Reads the fake.
+     *
+     * @param t_fakeIndex index of the fake.
+     * @return ArchiveFake - current sources and ir-drop of the fake.
+     */
+    ArchiveFake read(const uint64_t& t_fakeIndex) const;
+
+    /**
+     * @brief Writes the fake as netlist including the base netlist and ir-drop file, same as written without archive.
+     *
+     * @param t_fakeIndex index of the fake.
+     * @param t_netlistFileName path to the netlist file.
+     * @param t_irDropFileName path to the ir-drop file.
+     * @param t_baseNetlistInclude path to the base netlist relative to the netlist file.
+     * @return uint64_t - number of written lines.
+     */
+    uint64_t extract(const uint64_t& t_fakeIndex, const std::string& t_netlistFileName,
+        const std::string& t_irDropFileName, const std::string& t_baseNetlistInclude) const;
+};
+
+#endif
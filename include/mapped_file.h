@@ -0,0 +1,63 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// STL Libs
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Read-only view of a whole file mapped into memory. The file is not copied, pages are loaded by the system
+ * while the view is read.
+ *
+ */
+class MappedFile {
+    const char* m_data {};
+    uint64_t m_size {};
+    bool m_isOpen {};
+#ifdef _WIN32
+    void* m_file {};
+    void* m_mapping {};
+#else
+    int m_file { -1 };
+#endif
+
+public:
+    MappedFile() = default;
+    MappedFile(const std::string& t_fileName);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief Checks if the file is opened and mapped.
+     *
+     * @return true - file is mapped, empty files are mapped as empty view.
+     * @return false - file can not be opened.
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Gets the content of the file.
+     *
+     * @return std::string_view - view of the whole file.
+     */
+    std::string_view view() const;
+
+    /**
+     * @brief Gets the size of the file.
+     *
+     * @return uint64_t - size in bytes.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Calculates 64-bit hash of the content of the file.
+     *
+     * @return uint64_t - hash of the content.
+     */
+    uint64_t hash() const;
+};
+
+#endif
@@ -0,0 +1,135 @@
+#ifndef MULTIGRID_SOLVER_H
+#define MULTIGRID_SOLVER_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+
+/**
+ * @brief Sparse matrix in compressed sparse row format with the diagonal stored in rows.
+ *
+ */
+struct SparseMatrix {
+    uint64_t rowsSize {};
+    uint64_t columnsSize {};
+    std::vector<uint64_t> offsets {};
+    std::vector<uint64_t> columns {};
+    std::vector<Value> values {};
+};
+
+/**
+ * @brief One level of the multigrid hierarchy.
+ *
+ */
+struct MultigridLevel {
+    SparseMatrix matrix {};
+    SparseMatrix prolongation {};
+    SparseMatrix restriction {};
+    std::vector<Value> inverseDiagonal {};
+};
+
+/**
+ * @brief Smoothed aggregation algebraic multigrid of the conductance matrix.
+ *
+ * Nodes are aggregated by strength of their connections, so stripes of one metal layer and the vias between layers are
+ * coarsened the way they are coupled. The hierarchy is built once on construction, the matrix must not change its
+ * conductances afterwards. Cycles run on the workspace of the caller, so one hierarchy can be shared between threads.
+ */
+class MultigridSolver {
+    std::vector<MultigridLevel> m_levels {};
+    std::vector<Value> m_coarseFactor {};
+
+public:
+    MultigridSolver() = default;
+    ~MultigridSolver() = default;
+    MultigridSolver(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Solves the matrix with v-cycles starting from its current values.
+     *
+     * @param t_matrix matrix to solve.
+     * @param t_state currents of the rows, the solution is written to its values.
+     * @param t_precision relative residual norm to stop at.
+     * @param t_maxIterations max number of v-cycles.
+     * @param t_residual relative residual norm of the solution.
+     * @return uint64_t - number of v-cycles.
+     */
+    uint64_t solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision,
+        const uint64_t& t_maxIterations, Value& t_residual) const;
+
+    /**
+     * @brief Applies one v-cycle with zero initial guess, used as preconditioner.
+     *
+     * @param t_rightHandSide right hand side of the system.
+     * @param t_solution approximate solution.
+     * @param t_workspace work vectors of the levels.
+     */
+    void applyCycle(const std::vector<Value>& t_rightHandSide, std::vector<Value>& t_solution,
+        MultigridWorkspace& t_workspace) const;
+
+    /**
+     * @brief Sizes work vectors for every level of the hierarchy, vectors of the right size are kept.
+     *
+     * @param t_workspace work vectors to size.
+     */
+    void prepareWorkspace(MultigridWorkspace& t_workspace) const;
+
+    /**
+     * @brief Gets the number of levels of the hierarchy.
+     *
+     * @return uint64_t - number of levels.
+     */
+    uint64_t levelsSize() const;
+
+    /**
+     * @brief Gets the ratio of non zeros of all levels to non zeros of the finest one.
+     *
+     * @return Value - operator complexity.
+     */
+    Value operatorComplexity() const;
+
+private:
+    /**
+     * @brief Builds the coarser level from the last one.
+     *
+     * @return true - level is added.
+     * @return false - last level can not be coarsened.
+     */
+    bool coarsen();
+
+    /**
+     * @brief Factors the coarsest level with dense cholesky.
+     *
+     */
+    void factorCoarsest();
+
+    /**
+     * @brief Runs v-cycle from the level on its right hand side and solution.
+     *
+     * @param t_level index of the level.
+     * @param t_workspace work vectors of the levels.
+     */
+    void cycle(const uint64_t& t_level, MultigridWorkspace& t_workspace) const;
+
+    /**
+     * @brief Makes one gauss-seidel sweep on the level.
+     *
+     * @param t_level level to smooth.
+     * @param t_rightHandSide right hand side of the level.
+     * @param t_solution solution of the level.
+     * @param t_isForward direction of the sweep.
+     */
+    void smooth(const MultigridLevel& t_level, const std::vector<Value>& t_rightHandSide,
+        std::vector<Value>& t_solution, const bool& t_isForward) const;
+};
+
+#endif
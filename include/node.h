@@ -11,112 +11,159 @@
 // Types
 #include "types.h"
 
+class NodeStore;
+
+/**
+ * @brief Lightweight view of one node of the store: the store and the id of the node. It is valid while the store is.
+ *
+ */
 class Node {
-public:
-    bool isVoltageNode {};
-    bool isAbelToConnectVoltageSource {};
-    bool isAbelToConnectCurrentSource {};
-    bool isFakedByCurrentSource {};
-    Value realValue {};
-    Value value {};
-    Name name {};
-    NodePtrVec neighborNodes {};
-
-private:
-    Value m_sumOfCurrent {};
-    Value m_inverseSumOfResistance {};
-    L m_layer {};
-    X m_x {};
-    Y m_y {};
-    ResistorPtrVec m_connectedResistors {};
-    CurrentSourcePtrVec m_connectedCurrentSources {};
-    VoltageSourcePtrVec m_connectedVoltageSources {};
+    const NodeStore* m_store {};
+    uint64_t m_id {};
 
 public:
     Node() = default;
     ~Node() = default;
-    Node(const NodeCoords& t_node, const Name& t_name);
+    Node(const NodeStore& t_store, const uint64_t& t_id);
 
     /**
-     * @brief Add a inverse resistor value to this node.
+     * @brief Gets the id of the node, index of its fields in the store.
      *
-     * @param t_resistance resistance value to be added
+     * @return uint64_t - id of the node.
      */
-    void addInverseSumOfResistance(const Value& t_resistance);
+    uint64_t id() const;
 
     /**
      * @brief Gets the node coordinates.
      *
-     * @return NodeData - node coordinates.
+     * @return NodeCoords - node coordinates.
+     */
+    NodeCoords getCoordinates() const;
+
+    /**
+     * @brief Creates the name of the node from its coordinates. Name format: n1_m[layer]_[x]_[y].
+     *
+     * @return Name - name of the node.
+     */
+    Name getName() const;
+
+    /**
+     * @brief Writes the name of the node, same as getName.
+     *
+     * @param t_writer writer to write to.
      */
-    NodeCoords getCoordinates();
+    void writeName(BufferedWriter& t_writer) const;
 
     /**
-     * @brief Connects a resistor to this node.
+     * @brief Checks the flag of the node.
      *
-     * @param t_resistor resistor to be connected to this node.
+     * @param t_flag one of the flags of NodeStore.
+     * @return true - flag is set.
+     * @return false - flag is not set.
      */
-    void connectResistor(const ResistorPtr& t_resistor);
+    bool hasFlag(const uint8_t& t_flag) const;
 
     /**
-     * @brief Connects a current source to this node.
+     * @brief Gets the value of the node in the current solution.
      *
-     * @param t_currentSource current source to be connected to this node.
+     * @return Value - value of the node.
      */
-    void connectCurrentSource(const CurrentSourcePtr& t_currentSource);
+    Value value() const;
 
     /**
-     * @brief Connects a voltage source to this node.
+     * @brief Gets the value of the node in the solution of the real pdn.
      *
-     * @param t_voltageSource voltage source to be connected to this node.
+     * @return Value - real value of the node.
      */
-    void connectVoltageSource(const VoltageSourcePtr& t_voltageSource);
+    Value realValue() const;
+};
+
+/**
+ * @brief Nodes of the pdn stored field by field, every field is a contiguous array indexed by the id of the node. Loops
+ * over one field of all nodes touch only that array, and nodes hold no links to other elements: resistors and sources
+ * refer to nodes by their ids.
+ *
+ */
+class NodeStore {
+public:
+    // Flags of the node
+    constexpr static uint8_t VOLTAGE_NODE = 1;
+    constexpr static uint8_t ABEL_TO_CONNECT_VOLTAGE_SOURCE = 2;
+    constexpr static uint8_t ABEL_TO_CONNECT_CURRENT_SOURCE = 4;
+    constexpr static uint8_t FAKED_BY_CURRENT_SOURCE = 8;
+
+    std::vector<L> layers {};
+    std::vector<X> xs {};
+    std::vector<Y> ys {};
+    std::vector<uint8_t> flags {};
+    std::vector<Value> values {};
+    std::vector<Value> realValues {};
+
+public:
+    NodeStore() = default;
+    ~NodeStore() = default;
 
     /**
-     * @brief Disconnects a current source from this node.
+     * @brief Gets the number of nodes.
      *
-     * @param t_currentSource current source to be disconnected from this node.
+     * @return uint64_t - number of nodes.
      */
-    void disconnectCurrentSource(const CurrentSourcePtr& t_currentSource);
+    uint64_t size() const;
 
     /**
-     * @brief Disconnects a voltage source from this node.
+     * @brief Reserves memory for the nodes.
      *
-     * @param t_voltageSource voltage source to be disconnected from this node.
+     * @param t_size expected number of nodes.
      */
-    void disconnectVoltageSource(const VoltageSourcePtr& t_voltageSource);
+    void reserve(const uint64_t& t_size);
 
     /**
-     * @brief Initializes the node before dc ir-drop.
+     * @brief Releases memory reserved over the number of nodes.
      *
      */
-    void initializationDC();
+    void shrinkToFit();
 
     /**
-     * @brief Reinitializes the node without recalculation its default value.
+     * @brief Appends a node without flags and with zero values.
      *
+     * @param t_nodeCoords metal layer and coordinates of the node.
+     * @return uint64_t - id of the node.
      */
-    void reinitializationDC();
+    uint64_t add(const NodeCoords& t_nodeCoords);
 
     /**
-     * @brief Makes step for the node in calculation dc ir-drop.
+     * @brief Checks the flag of the node.
      *
+     * @param t_id id of the node.
+     * @param t_flag one of the flags.
+     * @return true - flag is set.
+     * @return false - flag is not set.
      */
-    int stepDC(const Value& t_precision);
+    bool hasFlag(const uint64_t& t_id, const uint8_t& t_flag) const;
 
     /**
-     * @brief Checks if this node is connected to vias.
+     * @brief Sets or clears the flag of the node.
+     *
+     * @param t_id id of the node.
+     * @param t_flag one of the flags.
+     * @param t_isSet true sets the flag, false clears it.
+     */
+    void setFlag(const uint64_t& t_id, const uint8_t& t_flag, const bool& t_isSet);
+
+    /**
+     * @brief Gets the node coordinates.
      *
-     * @return true - this node is connected to vias.
-     * @return false - this node is not connected to vias.
+     * @param t_id id of the node.
+     * @return NodeCoords - node coordinates.
      */
-    bool isViaNode();
+    NodeCoords getCoordinates(const uint64_t& t_id) const;
 
     /**
-     * @brief Disconnects the node from all other elements.
+     * @brief Gets the memory held by the fields of the nodes.
      *
+     * @return uint64_t - size in bytes.
      */
-    void fullyDisconnection();
+    uint64_t memorySize() const;
 };
 
-#endif
\ No newline at end of file
+#endif
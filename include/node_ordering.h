@@ -0,0 +1,87 @@
+#ifndef NODE_ORDERING_H
+#define NODE_ORDERING_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "node.h"
+#include "resistor.h"
+
+/**
+ * @brief Orders rows of the conductance matrix so that connected nodes are close in memory. Nodes are ordered along a
+ * space filling curve over their coordinates or by reverse Cuthill-McKee over the resistor graph, only the order of
+ * rows changes and the ids of nodes are kept.
+ *
+ */
+class NodeOrdering {
+public:
+    // Position of the node which is not ordered
+    constexpr static uint64_t NO_POSITION = std::numeric_limits<uint64_t>::max();
+
+    /**
+     * @brief Orders the nodes.
+     *
+     * @param t_nodes store of the nodes.
+     * @param t_resistors store of the resistors, only used by reverse Cuthill-McKee.
+     * @param t_orderNodes ids of the nodes to order.
+     * @param t_type type of the ordering.
+     * @return std::vector<uint64_t> - ids of the same nodes in the new order.
+     */
+    static std::vector<uint64_t> order(const NodeStore& t_nodes, const ResistorStore& t_resistors,
+        const std::vector<uint64_t>& t_orderNodes, const OrderingType& t_type);
+
+private:
+    /**
+     * @brief Orders the nodes along the Morton or the Hilbert curve over ranks of their x and y, nodes of the same
+     * point are ordered by layer, so the ends of vias stay together.
+     *
+     * @param t_nodes store of the nodes.
+     * @param t_orderNodes ids of the nodes to order.
+     * @param t_type Morton or Hilbert.
+     * @return std::vector<uint64_t> - ids of the same nodes in the new order.
+     */
+    static std::vector<uint64_t> orderByCurve(const NodeStore& t_nodes, const std::vector<uint64_t>& t_orderNodes,
+        const OrderingType& t_type);
+
+    /**
+     * @brief Orders the nodes by breadth first search from a pseudo peripheral node of every connected component,
+     * neighbors are visited from the lowest degree, and reverses the order.
+     *
+     * @param t_nodes store of the nodes.
+     * @param t_resistors store of the resistors.
+     * @param t_orderNodes ids of the nodes to order.
+     * @return std::vector<uint64_t> - ids of the same nodes in the new order.
+     */
+    static std::vector<uint64_t> orderByReverseCuthillMcKee(const NodeStore& t_nodes, const ResistorStore& t_resistors,
+        const std::vector<uint64_t>& t_orderNodes);
+
+    /**
+     * @brief Interleaves bits of x and y: bit i of x goes to bit 2i and bit i of y to bit 2i + 1.
+     *
+     * @param t_x x of the point.
+     * @param t_y y of the point.
+     * @return uint64_t - index of the point on the Morton curve.
+     */
+    static uint64_t mortonIndex(const uint32_t& t_x, const uint32_t& t_y);
+
+    /**
+     * @brief Finds the index of the point on the Hilbert curve filling the square of the side 2^t_bits.
+     *
+     * @param t_x x of the point.
+     * @param t_y y of the point.
+     * @param t_bits number of bits of coordinates.
+     * @return uint64_t - index of the point on the Hilbert curve.
+     */
+    static uint64_t hilbertIndex(const uint32_t& t_x, const uint32_t& t_y, const uint32_t& t_bits);
+};
+
+#endif
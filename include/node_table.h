@@ -0,0 +1,75 @@
+#ifndef NODE_TABLE_H
+#define NODE_TABLE_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+/**
+ * @brief Open addressing hash table from packed node coordinates to the index of the node.
+ *
+ * Keys are probed linearly in a power of two table that is kept at most half full.
+ */
+class NodeTable {
+public:
+    // Value returned for keys which are not in the table
+    constexpr static uint64_t NO_INDEX = std::numeric_limits<uint64_t>::max();
+
+private:
+    std::vector<uint64_t> m_keys {};
+    std::vector<uint64_t> m_indexes {};
+    uint64_t m_size {};
+
+public:
+    NodeTable() = default;
+    ~NodeTable() = default;
+    NodeTable(const uint64_t& t_expectedSize);
+
+    /**
+     * @brief Packs the metal layer and coordinates of the node into one key: 8 bits of layer, 28 bits of x and y.
+     *
+     * @param t_nodeCoords metal layer and coordinates of the node.
+     * @return uint64_t - packed key.
+     */
+    static uint64_t packKey(const NodeCoords& t_nodeCoords);
+
+    /**
+     * @brief Finds the index of the key or inserts the given one.
+     *
+     * @param t_key packed key of the node.
+     * @param t_index index to insert if the key is not in the table.
+     * @return uint64_t - index stored for the key.
+     */
+    uint64_t insert(const uint64_t& t_key, const uint64_t& t_index);
+
+    /**
+     * @brief Finds the index of the key.
+     *
+     * @param t_key packed key of the node.
+     * @return uint64_t - index of the node, NO_INDEX if the key is not in the table.
+     */
+    uint64_t find(const uint64_t& t_key) const;
+
+    /**
+     * @brief Gets the number of keys in the table.
+     *
+     * @return uint64_t - number of keys.
+     */
+    uint64_t size() const;
+
+private:
+    /**
+     * @brief Doubles the capacity of the table and reinserts all keys.
+     *
+     */
+    void grow();
+};
+
+#endif
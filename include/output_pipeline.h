@@ -0,0 +1,125 @@
+#ifndef OUTPUT_PIPELINE_H
+#define OUTPUT_PIPELINE_H
+
+// STL Libs
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "dataset_archive.h"
+#include "pdn_snapshot.h"
+#include "rasterizer.h"
+
+/**
+ * @brief Bounded queue of fake snapshots written to files by a set of writer threads, so the generator solves the
+ * next fake while the previous ones are written. Push blocks while the queue is full, so at most capacity snapshots
+ * wait in the queue plus one per writer thread. Without writer threads snapshots are written on the pushing thread.
+ * With the archive snapshots are appended to it instead of their files. With the rasterizer maps of snapshots are
+ * written to their maps folder.
+ *
+ */
+class OutputPipeline {
+    std::vector<std::thread> m_threads {};
+    std::deque<std::unique_ptr<const PDNSnapshot>> m_queue {};
+    uint64_t m_capacity {};
+    DatasetArchiveWriter* m_archive {};
+    Rasterizer* m_rasterizer {};
+    std::mutex m_mutex {};
+    std::condition_variable m_pushCondition {};
+    std::condition_variable m_popCondition {};
+    std::exception_ptr m_exception {};
+    bool m_isStopping {};
+    uint64_t m_totalLines {};
+    uint64_t m_totalSize {};
+    uint64_t m_writingDuration {};
+    uint64_t m_rasterizingDuration {};
+    uint64_t m_blockedDuration {};
+    uint64_t m_memorySize {};
+    uint64_t m_peakMemorySize {};
+
+public:
+    OutputPipeline(const uint64_t& t_threads, const uint64_t& t_capacity, DatasetArchiveWriter* t_archive = nullptr,
+        Rasterizer* t_rasterizer = nullptr);
+    ~OutputPipeline();
+
+    /**
+     * @brief Hands the snapshot to the writers, waits while the queue is full.
+     *
+     * @param t_snapshot snapshot to write.
+     */
+    void push(std::unique_ptr<const PDNSnapshot> t_snapshot);
+
+    /**
+     * @brief Waits until all snapshots are written and stops the writer threads. Rethrows the first error of writers.
+     *
+     */
+    void finish();
+
+    /**
+     * @brief Gets the number of lines written to all files.
+     *
+     * @return uint64_t - number of lines.
+     */
+    uint64_t getTotalLines() const;
+
+    /**
+     * @brief Gets the number of characters written to all files.
+     *
+     * @return uint64_t - number of characters.
+     */
+    uint64_t getTotalSize() const;
+
+    /**
+     * @brief Gets the time spent by all writers on writing files.
+     *
+     * @return uint64_t - time in microseconds.
+     */
+    uint64_t getWritingDuration() const;
+
+    /**
+     * @brief Gets the time spent by all writers on rasterizing maps, it is a part of the writing time.
+     *
+     * @return uint64_t - time in microseconds.
+     */
+    uint64_t getRasterizingDuration() const;
+
+    /**
+     * @brief Gets the time pushing threads waited for room in the full queue, or for the write without writers.
+     *
+     * @return uint64_t - time in microseconds.
+     */
+    uint64_t getBlockedDuration() const;
+
+    /**
+     * @brief Gets the largest memory held by queued and written snapshots at once.
+     *
+     * @return uint64_t - size in bytes.
+     */
+    uint64_t getPeakMemorySize() const;
+
+private:
+    /**
+     * @brief Writes both files of the snapshot or appends it to the archive and adds the result to the statistics.
+     *
+     * @param t_snapshot snapshot to write.
+     * @param t_writer writer to write with.
+     */
+    void write(const PDNSnapshot& t_snapshot, BufferedWriter& t_writer);
+
+    /**
+     * @brief Loop of the writer thread.
+     *
+     */
+    void workerLoop();
+};
+
+#endif
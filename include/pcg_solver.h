@@ -0,0 +1,77 @@
+#ifndef PCG_SOLVER_H
+#define PCG_SOLVER_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+#include "multigrid_solver.h"
+
+/**
+ * @brief Preconditioned conjugate gradient solver of the conductance matrix.
+ *
+ * The preconditioner is built once on construction, the matrix must not change its conductances afterwards. Solves do
+ * not modify the solver, so one preconditioner can be shared between threads.
+ */
+class PCGSolver {
+    PreconditionerType m_preconditionerType {};
+    std::vector<Value> m_inverseDiagonal {};
+    std::vector<Value> m_factorDiagonal {};
+    std::vector<uint64_t> m_factorOffsets {};
+    std::vector<uint64_t> m_factorColumns {};
+    std::vector<Value> m_factorValues {};
+    std::unique_ptr<MultigridSolver> m_multigridSolver {};
+
+public:
+    PCGSolver() = default;
+    ~PCGSolver() = default;
+    PCGSolver(const ConductanceMatrix& t_matrix, const PreconditionerType& t_preconditionerType);
+
+    /**
+     * @brief Solves the matrix starting from its current values.
+     *
+     * @param t_matrix matrix to solve.
+     * @param t_state currents of the rows, the solution is written to its values.
+     * @param t_precision relative residual norm to stop at.
+     * @param t_maxIterations max number of iterations.
+     * @param t_residual relative residual norm of the solution.
+     * @return uint64_t - number of iterations.
+     */
+    uint64_t solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision,
+        const uint64_t& t_maxIterations, Value& t_residual) const;
+
+    /**
+     * @brief Gets the multigrid hierarchy used as preconditioner.
+     *
+     * @return const MultigridSolver* - hierarchy, nullptr for other preconditioners.
+     */
+    const MultigridSolver* getMultigridSolver() const;
+
+private:
+    /**
+     * @brief Builds incomplete cholesky factor with zero fill-in of the matrix.
+     *
+     * @param t_matrix matrix to factor.
+     */
+    void factorIncompleteCholesky(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Applies the preconditioner to the residual.
+     *
+     * @param t_residual residual to precondition.
+     * @param t_preconditioned preconditioned residual.
+     * @param t_workspace work vectors of the multigrid preconditioner.
+     */
+    void precondition(const std::vector<Value>& t_residual, std::vector<Value>& t_preconditioned,
+        MultigridWorkspace& t_workspace) const;
+};
+
+#endif
@@ -8,24 +8,81 @@
 #include <random>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // Types
 #include "types.h"
 
+// Project Libs
+#include "buffered_writer.h"
+#include "candidate_pool.h"
+#include "cholesky_solver.h"
+#include "conductance_matrix.h"
+#include "mapped_file.h"
+#include "multigrid_solver.h"
+#include "node.h"
+#include "pcg_solver.h"
+#include "pdn_snapshot.h"
+#include "refinement_solver.h"
+#include "resistor.h"
+#include "stencil_grid.h"
+
+/**
+ * @brief Saved current sources of the pdn and the state of its random number generator, used to roll back changes of
+ * current sources. Only current sources, flags of their nodes and marks of the candidate pools are saved, placement
+ * changes flags of other nodes only by taking them from the pool of free nodes. Values of the solution are optional.
+ *
+ */
+struct PDNCheckpoint {
+    std::vector<CurrentSource> currentSources {};
+    std::vector<uint8_t> nodeFlags {};
+    uint64_t freeNodesMark {};
+    uint64_t originalCurrentSourcesMark {};
+    std::vector<Value> values {};
+    std::mt19937 generator {};
+    Value currentScale {};
+};
+
 class PDNContainer {
     Value m_voltageSourceValue {};
-    std::vector<std::string> m_file {};
-    std::vector<std::shared_ptr<Node>> m_nodes {};
-    std::vector<std::shared_ptr<Resistor>> m_resistors {};
+    std::unique_ptr<MappedFile> m_file {};
+    uint64_t m_totalLines {};
+    std::shared_ptr<NodeStore> m_nodes { std::make_shared<NodeStore>() };
+    std::shared_ptr<ResistorStore> m_resistors { std::make_shared<ResistorStore>() };
     std::vector<std::shared_ptr<VoltageSource>> m_voltageSources {};
     std::vector<std::shared_ptr<CurrentSource>> m_currentSources {};
     std::mt19937 m_generator {};
+    std::shared_ptr<const ConductanceMatrix> m_conductanceMatrix { std::make_shared<ConductanceMatrix>() };
+    ConductanceState m_conductanceState {};
+    SolverType m_solverType { SolverType::GaussSeidel };
+    PreconditionerType m_preconditionerType { PreconditionerType::Jacobi };
+    OrderingType m_orderingType { OrderingType::Netlist };
+    PrecisionType m_precisionType { PrecisionType::Double };
+    std::shared_ptr<const PCGSolver> m_pcgSolver {};
+    std::shared_ptr<const CholeskySolver> m_choleskySolver {};
+    std::shared_ptr<const MultigridSolver> m_multigridSolver {};
+    std::shared_ptr<const StencilGrid> m_stencilGrid {};
+    std::shared_ptr<const RefinementSolver<float>> m_refinementSolver {};
+    std::shared_ptr<ThreadPool> m_threadPool {};
+    Value m_lastResidual {};
+    Value m_currentScale { 1 };
+    std::vector<Value> m_sensitivities {};
+    CandidatePool m_freeNodes {};
+    CandidatePool m_originalCurrentSources {};
+    Value m_minCurrentSourceValue {};
+    Value m_maxCurrentSourceValue {};
+    bool m_isFork {};
+    std::string m_cacheFileName {};
+    uint64_t m_sourceHash {};
+    bool m_isRealValuesCached {};
+    std::shared_ptr<const PDNTopology> m_topology {};
+    BufferedWriter m_writer {};
 
 public:
     PDNContainer() = default;
-    PDNContainer(const std::string& t_fileName);
-    ~PDNContainer();
+    PDNContainer(const std::string& t_fileName, const bool& t_isCached = false);
+    ~PDNContainer() = default;
 
 private:
     // =================================================================
@@ -37,14 +94,99 @@ private:
      * @param t_nodeName name of the node.
      * @return NodeData - std::array<uint32_t, 3> - coordinates and metal layer.
      */
-    NodeCoords parseNodeName(const std::string& t_nodeName);
+    NodeCoords parseNodeName(const std::string_view& t_nodeName);
+
+    /**
+     * @brief Builds the conductance matrix of the pdn from the current graph.
+     *
+     */
+    void buildConductanceMatrix();
+
+    /**
+     * @brief Gathers values of current sources into the rows of the conductance matrix.
+     *
+     */
+    void updateMatrixCurrents();
+
+    /**
+     * @brief Copies the solution of the conductance matrix into the pdn nodes.
+     *
+     */
+    void updateNodeValues();
+
+    /**
+     * @brief Solves the conductance system of the state with the selected solver, starting from its values.
+     *
+     * @param t_state currents of the rows, the solution is written to its values.
+     * @param t_precision precision of the solve.
+     * @param t_maxIterations max number of iterations of the solve.
+     * @return uint64_t - number of iterations of the solve.
+     */
+    uint64_t solveState(ConductanceState& t_state, const Value& t_precision, const uint64_t& t_maxIterations);
+
+    /**
+     * @brief Connects a new fake current source to the node.
+     *
+     * @param t_nodeIndex index of the node.
+     * @param t_value value of the current source.
+     */
+    void connectFakeCurrentSource(const uint64_t& t_nodeIndex, const Value& t_value);
+
+    /**
+     * @brief Moves the current source to the node.
+     *
+     * @param t_currentSourceIndex index of the current source.
+     * @param t_nodeIndex index of the node.
+     */
+    void moveCurrentSource(const uint64_t& t_currentSourceIndex, const uint64_t& t_nodeIndex);
+
+    /**
+     * @brief Collects nodes able to get a fake current source and current sources on their original nodes into the
+     * pools of candidates, placement methods keep the pools up to date.
+     *
+     */
+    void buildCandidatePools();
+
+    /**
+     * @brief Finds the range of values of current sources, values of fake current sources are drawn from it.
+     *
+     */
+    void updateCurrentSourceValueRange();
+
+    /**
+     * @brief Measures the time of one gauss-seidel sweep over the conductance matrix.
+     *
+     * @return Value - mean time of the sweep in milliseconds.
+     */
+    Value measureSweepTime() const;
+
+    /**
+     * @brief Prints the information about the multigrid hierarchy.
+     *
+     * @param t_multigridSolver hierarchy to print.
+     */
+    void printMultigridInformation(const MultigridSolver& t_multigridSolver);
+
+    /**
+     * @brief Builds the pdn graph from the binary cache of the source file.
+     *
+     * @return true - cache matches the source and the graph is built.
+     * @return false - cache is missing, stale or broken, nothing is built.
+     */
+    bool readCache();
+
+    /**
+     * @brief Writes the pdn graph and real node values to the binary cache of the source file.
+     *
+     */
+    void writeCache();
 
 public:
     // =================================================================
     // PDN methods
 
     /**
-     * @brief Disconnects all elements from each others.
+     * @brief Drops all elements of the pdn. Elements refer to nodes by ids, so they hold no links to be broken.
      *
      */
     void fullyDisconnection();
@@ -55,6 +197,43 @@ public:
      */
     void resetWorkingGraph();
 
+    /**
+     * @brief Creates an independent copy of the current pdn to generate fakes in parallel. Resistors, voltage sources,
+     * the conductance matrix and the solvers are shared with this container, the node store and current sources are
+     * copied.
+     * The thread pool is not copied, it runs one parallel loop at a time, so the copy runs its solver on the calling
+     * thread. The copy can not be reset.
+     *
+     * @param t_seed seed of the random number generator of the copy.
+     * @return std::unique_ptr<PDNContainer> - copy of the pdn.
+     */
+    std::unique_ptr<PDNContainer> fork(const uint64_t& t_seed) const;
+
+    /**
+     * @brief Saves current sources of the pdn, their nodes and the random number generator in time proportional to the
+     * number of current sources.
+     *
+     * @param t_isSolutionSaved also saves values of the solution, it takes time proportional to the number of nodes.
+     * @return PDNCheckpoint - saved state.
+     */
+    PDNCheckpoint createCheckpoint(const bool& t_isSolutionSaved = false) const;
+
+    /**
+     * @brief Rolls current sources of the pdn, their nodes and the random number generator back to the checkpoint in
+     * time proportional to the number of current sources. Node values are restored if the checkpoint has them, kept as
+     * the initial guess of the next solve otherwise. Checkpoints taken after this one are no longer valid.
+     *
+     * @param t_checkpoint saved state.
+     */
+    void restoreCheckpoint(const PDNCheckpoint& t_checkpoint);
+
+    /**
+     * @brief Seeds the random number generator used to place fake current sources.
+     *
+     * @param t_seed seed of the generator.
+     */
+    void setSeed(const uint64_t& t_seed);
+
     // =================================================================
     // Change current sources
 
@@ -79,15 +258,98 @@ public:
      */
     void inverseCurrentSourcesPositions(const Value& t_percentage);
 
+    /**
+     * @brief Connects fake current sources to random nodes until the change of the mean ir-drop difference predicted by
+     * the sensitivities reaches t_difference. Needs calculateSensitivities.
+     *
+     * @param t_difference change of the mean ir-drop difference.
+     */
+    void connectGuidedCurrentSources(const Value& t_difference);
+
+    /**
+     * @brief Scales current sources so the ir-drop of every node is (1 + t_difference) times the real one. The network is
+     * linear, so node values are set from the real solution without solving.
+     *
+     * @param t_difference relative difference of the ir-drop from the real one.
+     */
+    void scaleIRDrop(const Value& t_difference);
+
     // =================================================================
     // IR-drop methods
 
+    /**
+     * @brief Sets the solver used for the ir-drop calculation. The conductance matrix is rebuilt when the stencil solver
+     * is set or unset, since lattices of layers take the first rows, and lattices are printed.
+     *
+     * @param t_solver name of the solver: 'gs', 'pcg', 'cholesky', 'amg', 'local' or 'stencil'.
+     * @param t_preconditioner name of the pcg preconditioner: 'jacobi', 'ic' or 'amg'.
+     */
+    void setSolver(const std::string& t_solver, const std::string& t_preconditioner);
+
+    /**
+     * @brief Sets the order of rows of the conductance matrix and rebuilds it, node ids and the order of the output are
+     * kept. Prints the locality of the matrix and the time of the sweep before and after. Must be set before solving.
+     *
+     * @param t_ordering name of the ordering: 'netlist', 'morton', 'hilbert' or 'rcm'.
+     */
+    void setOrdering(const std::string& t_ordering);
+
+    /**
+     * @brief Sets the precision of sweeps of the gauss-seidel solver on one thread. Sweeps in float solve corrections
+     * of the solution refined in double, so solutions meet the same precision.
+     *
+     * @param t_precision name of the precision: 'double' or 'float'.
+     */
+    void setWorkingPrecision(const std::string& t_precision);
+
+    /**
+     * @brief Measures the time of every vector kernel on the conductance matrix and the nodes of the pdn with every
+     * version supported by the cpu and prints it with the speedup over the scalar version. Real values must be solved.
+     *
+     */
+    void benchmarkKernels();
+
+    /**
+     * @brief Sets the number of threads used by the ir-drop calculation.
+     *
+     * @param t_threads number of threads, 1 keeps the sequential gauss-seidel sweep.
+     */
+    void setThreads(const uint64_t& t_threads);
+
+    /**
+     * @brief Gets the relative residual norm after the last solve.
+     *
+     * @return Value - relative residual norm, zero for gauss-seidel.
+     */
+    Value getLastResidual();
+
     /**
      * @brief Solves the ir-drop for current pdn.
      *
      */
     uint64_t solveDC(const Value& t_precision, const uint64_t& t_maxIterations);
 
+    /**
+     * @brief Solves the ir-drop starting from the current node values and compares the solution with them.
+     *
+     * @param t_precision precision of the solve.
+     * @param t_maxIterations max number of iterations of the solve.
+     * @param t_error max difference of node values relative to the max ir-drop of the solution.
+     * @return uint64_t - number of iterations of the solve.
+     */
+    uint64_t verifyIRDrop(const Value& t_precision, const uint64_t& t_maxIterations, Value& t_error);
+
+    /**
+     * @brief Calculates the sensitivity of the mean ir-drop difference to a unit current injected to or removed from
+     * every node with one adjoint solve. It is the exact change when no node difference changes its sign, as for added
+     * current sources, and the upper bound of the change otherwise.
+     *
+     * @param t_precision precision of the solve.
+     * @param t_maxIterations max number of iterations of the solve.
+     * @return uint64_t - number of iterations of the solve.
+     */
+    uint64_t calculateSensitivities(const Value& t_precision, const uint64_t& t_maxIterations);
+
     /**
      * @brief Saves real values of real pdn nodes.
      *
@@ -109,19 +371,47 @@ public:
     // =================================================================
     // Write/save methods
 
+    /**
+     * @brief Copies the current sources and the ir-drop solution of the current pdn to write them later.
+     *
+     * @param t_netlistFileName path to the netlist file of the snapshot.
+     * @param t_irDropFileName path to the ir-drop file of the snapshot.
+     * @param t_baseNetlistInclude path to the base netlist relative to the netlist file, empty writes the whole netlist.
+     * @return std::unique_ptr<PDNSnapshot> - snapshot of the pdn.
+     */
+    std::unique_ptr<PDNSnapshot> createSnapshot(const std::string& t_netlistFileName,
+        const std::string& t_irDropFileName, const std::string& t_baseNetlistInclude = {}) const;
+
+    /**
+     * @brief Gets the part of the pdn that does not change while fakes are generated.
+     *
+     * @return std::shared_ptr<const PDNTopology> - nodes, resistors and voltage sources of the pdn.
+     */
+    std::shared_ptr<const PDNTopology> getTopology() const;
+
+    /**
+     * @brief Writes resistors and voltage sources, the part of the netlist that is the same for all fakes.
+     *
+     * @param t_fileName path to the file to write to.
+     * @return uint64_t - number of written lines.
+     */
+    uint64_t writeBaseNetlistToFile(const std::string& t_fileName);
+
     /**
      * @brief Writes ir-drop solution of current pdn to a file.
      *
      * @param t_fileName path to the file to write to.
+     * @return uint64_t - number of written lines.
      */
-    void writeIRDropToFile(const std::string& t_fileName);
+    uint64_t writeIRDropToFile(const std::string& t_fileName);
 
     /**
      * @brief Writes the PDN container to a file in spice format.
      *
      * @param t_fileName path to the file to write to.
+     * @return uint64_t - number of written lines.
      */
-    void writeNetlistToFile(const std::string& t_fileName);
+    uint64_t writeNetlistToFile(const std::string& t_fileName);
 };
 
 #endif
\ No newline at end of file
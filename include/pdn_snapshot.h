@@ -0,0 +1,81 @@
+#ifndef PDN_SNAPSHOT_H
+#define PDN_SNAPSHOT_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "current_source.h"
+#include "node.h"
+#include "resistor.h"
+
+/**
+ * @brief Part of the pdn that does not change while fakes are generated, shared by the pdn, its forks and all of
+ * their snapshots. Only coordinates of the nodes are read from it.
+ *
+ */
+struct PDNTopology {
+    Value voltageSourceValue {};
+    std::shared_ptr<const NodeStore> nodes {};
+    std::shared_ptr<const ResistorStore> resistors {};
+    VoltageSourcePtrVec voltageSources {};
+
+    /**
+     * @brief Writes resistors and voltage sources in spice format, the part of the netlist shared by all fakes.
+     *
+     * @param t_writer writer to write with.
+     * @param t_fileName path to the file to write to.
+     * @return uint64_t - number of written lines.
+     */
+    uint64_t writeBaseNetlist(BufferedWriter& t_writer, const std::string& t_fileName) const;
+};
+
+/**
+ * @brief Immutable copy of one fake: placements and values of its current sources and the ir-drop solution of its
+ * nodes. A snapshot is written independently from the pdn, so the pdn can go on to the next fake meanwhile.
+ *
+ */
+class PDNSnapshot {
+public:
+    std::shared_ptr<const PDNTopology> topology {};
+    uint64_t fakeIndex {};
+    std::vector<CurrentSource> currentSources {};
+    std::vector<Value> nodeValues {};
+    std::string netlistFileName {};
+    std::string irDropFileName {};
+    std::string baseNetlistInclude {};
+    std::string mapsFolderName {};
+
+    /**
+     * @brief Gets the approximate memory held by the snapshot, the shared topology is not counted.
+     *
+     * @return uint64_t - size in bytes.
+     */
+    uint64_t memorySize() const;
+
+    /**
+     * @brief Writes the netlist of the fake in spice format to its netlist file. With the base netlist include the file
+     * holds only the include of the base netlist and the current sources of the fake.
+     *
+     * @param t_writer writer to write with.
+     * @return uint64_t - number of written lines.
+     */
+    uint64_t writeNetlist(BufferedWriter& t_writer) const;
+
+    /**
+     * @brief Writes the ir-drop solution of the fake to its ir-drop file.
+     *
+     * @param t_writer writer to write with.
+     * @return uint64_t - number of written lines.
+     */
+    uint64_t writeIRDrop(BufferedWriter& t_writer) const;
+};
+
+#endif
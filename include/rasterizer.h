@@ -0,0 +1,108 @@
+#ifndef RASTERIZER_H
+#define RASTERIZER_H
+
+// STL Libs
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "pdn_snapshot.h"
+#include "thread_pool.h"
+
+/**
+ * @brief Rasterizes nodes of the pdn into 2D grids of bins, one grid per metal layer, and writes them as float32 .npy
+ * arrays of shape (height, width). All layers share the same grid, so maps of one fake are aligned. The bin of every
+ * node is found once on construction, so the maps of a fake are a single pass over its nodes and current sources.
+ *
+ */
+class Rasterizer {
+public:
+    // Cell of nodes which are not rasterized
+    constexpr static uint64_t NO_CELL = std::numeric_limits<uint64_t>::max();
+
+private:
+    uint32_t m_binSize {};
+    uint32_t m_minX {};
+    uint32_t m_minY {};
+    uint64_t m_width {};
+    uint64_t m_height {};
+    std::vector<uint32_t> m_layers {};
+    std::vector<uint64_t> m_nodeCells {};
+    std::vector<uint64_t> m_layerNodeOffsets {};
+    std::vector<uint64_t> m_layerNodes {};
+    std::vector<float> m_resistanceMap {};
+    std::unique_ptr<ThreadPool> m_threadPool {};
+    std::mutex m_mutex {};
+
+public:
+    Rasterizer(const PDNTopology& t_topology, const uint32_t& t_binSize, const uint64_t& t_threads);
+    ~Rasterizer() = default;
+
+    /**
+     * @brief Gets the number of bins of one map along x.
+     *
+     * @return uint64_t - width of the map.
+     */
+    uint64_t width() const;
+
+    /**
+     * @brief Gets the number of bins of one map along y.
+     *
+     * @return uint64_t - height of the map.
+     */
+    uint64_t height() const;
+
+    /**
+     * @brief Gets metal layers of the maps.
+     *
+     * @return const std::vector<uint32_t>& - metal layers in ascending order.
+     */
+    const std::vector<uint32_t>& getLayers() const;
+
+    /**
+     * @brief Writes the total resistance of resistors in every bin, it is the same for all fakes. Half of the resistor is
+     * counted in the bin of each of its nodes. File name: resistance-map-m[layer].npy.
+     *
+     * @param t_folderName folder to write to.
+     * @return uint64_t - number of written bytes.
+     */
+    uint64_t writeResistanceMaps(const std::string& t_folderName);
+
+    /**
+     * @brief Writes the max ir-drop of nodes and the total current of current sources in every bin of the fake. Layers are
+     * rasterized in parallel. File names: ir-drop-map-m[layer].npy and current-map-m[layer].npy.
+     *
+     * @param t_snapshot snapshot of the fake.
+     * @param t_folderName folder to write to.
+     * @return uint64_t - number of written bytes.
+     */
+    uint64_t writeFakeMaps(const PDNSnapshot& t_snapshot, const std::string& t_folderName);
+
+private:
+    /**
+     * @brief Finds the bin of the node.
+     *
+     * @param t_nodeCoords metal layer and coordinates of the node.
+     * @return uint64_t - index of the bin in the maps of all layers, NO_CELL for the ground node.
+     */
+    uint64_t findCell(const NodeCoords& t_nodeCoords) const;
+
+    /**
+     * @brief Writes one map of every layer.
+     *
+     * @param t_maps maps of all layers one after another.
+     * @param t_folderName folder to write to.
+     * @param t_name name of the map.
+     * @return uint64_t - number of written bytes.
+     */
+    uint64_t writeMaps(const std::vector<float>& t_maps, const std::string& t_folderName, const std::string& t_name);
+};
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef REFINEMENT_SOLVER_H
+#define REFINEMENT_SOLVER_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+
+/**
+ * @brief Gauss-Seidel solver with sweeps in the working precision T and iterative refinement in Value precision.
+ *
+ * The matrix is copied once in T with 32-bit indices, so a sweep in float reads half of the bytes of a sweep over the
+ * conductance matrix. Every refinement calculates the residual of the solution in Value precision, solves the
+ * correction by sweeps in T and adds it to the solution, so rounding errors of T do not accumulate in the solution.
+ * Solves do not modify the solver, so one copy can be shared between threads.
+ */
+template <typename T>
+class RefinementSolver {
+    std::vector<T> m_inverseDiagonal {};
+    std::vector<uint32_t> m_rowOffsets {};
+    std::vector<uint32_t> m_columnIndices {};
+    std::vector<T> m_conductances {};
+
+public:
+    RefinementSolver() = default;
+    ~RefinementSolver() = default;
+
+    RefinementSolver(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Solves the matrix starting from its current values. Sweeps of a refinement stop when every correction
+     * changes less than the precision, the solve stops when the first sweep of a refinement does.
+     *
+     * @param t_matrix matrix to solve.
+     * @param t_state currents of the rows, the solution is written to its values.
+     * @param t_precision max change of the row value to count it as solved.
+     * @param t_maxIterations max number of sweeps.
+     * @return uint64_t - number of sweeps.
+     */
+    uint64_t solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision,
+        const uint64_t& t_maxIterations) const;
+
+    /**
+     * @brief Gets the memory held by the copy of the matrix.
+     *
+     * @return uint64_t - size in bytes.
+     */
+    uint64_t memorySize() const;
+
+private:
+    /**
+     * @brief Makes one in-place gauss-seidel sweep of corrections over all rows.
+     *
+     * @param t_residuals residuals of rows.
+     * @param t_corrections corrections of rows.
+     * @param t_precision max change of the correction to count the row as solved.
+     * @return uint64_t - number of solved rows.
+     */
+    uint64_t sweep(const std::vector<T>& t_residuals, std::vector<T>& t_corrections, const T& t_precision) const;
+};
+
+#endif
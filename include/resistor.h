@@ -6,27 +6,57 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // Types
 #include "types.h"
 
-class Resistor {
-public:
-    Value value {};
-    Name name {};
-    NodePtrVec connectedNodes {};
+class NodeStore;
+class ResistorStore;
 
-private:
-    std::array<L, 2> m_layer {};
-    std::array<X, 2> m_x {};
-    std::array<Y, 2> m_y {};
+/**
+ * @brief Lightweight view of one resistor of the store, coordinates are read from the nodes it connects. It is valid
+ * while both stores are.
+ *
+ */
+class Resistor {
+    const ResistorStore* m_store {};
+    const NodeStore* m_nodes {};
+    uint64_t m_id {};
 
 public:
     Resistor() = default;
     ~Resistor() = default;
-    Resistor(const NodeCoords& t_fistNode, const NodeCoords& t_secondNode, const Value& t_value,
-        const Name& t_name);
+    Resistor(const ResistorStore& t_store, const NodeStore& t_nodes, const uint64_t& t_id);
+
+    /**
+     * @brief Gets the name of the resistor.
+     *
+     * @return std::string_view - name of the resistor, it points into the store.
+     */
+    std::string_view name() const;
+
+    /**
+     * @brief Gets the resistance of the resistor.
+     *
+     * @return Value - resistance.
+     */
+    Value value() const;
+
+    /**
+     * @brief Gets ids of both nodes of the resistor.
+     *
+     * @return std::array<uint64_t, 2> - ids of the first and the second node.
+     */
+    std::array<uint64_t, 2> getNodes() const;
+
+    /**
+     * @brief Gets coordinates of both nodes of the resistor.
+     *
+     * @return std::array<NodeCoords, 2> - coordinates of the first and the second node.
+     */
+    std::array<NodeCoords, 2> getCoordinates() const;
 
     /**
      * @brief Checks if the resistor is vias;
@@ -34,20 +64,88 @@ public:
      * @return true - resistor is vias;
      * @return false - resistor is not vias.
      */
-    bool isViaResistor();
+    bool isViaResistor() const;
 
     /**
      * @brief Creates line description of the resistor in spice format.
      *
      * @return std::string - line description.
      */
-    std::string toString();
+    std::string toString() const;
+
+    /**
+     * @brief Writes line description of the resistor in spice format, same as toString.
+     *
+     * @param t_writer writer to write to.
+     */
+    void write(BufferedWriter& t_writer) const;
+};
+
+/**
+ * @brief Resistors of the pdn stored field by field, every field is a contiguous array indexed by the id of the
+ * resistor. Nodes are stored as their ids and names are packed into one buffer.
+ *
+ */
+class ResistorStore {
+public:
+    std::vector<uint64_t> firstNodes {};
+    std::vector<uint64_t> secondNodes {};
+    std::vector<Value> values {};
+
+private:
+    std::string m_names {};
+    std::vector<uint64_t> m_nameOffsets { 0 };
+
+public:
+    ResistorStore() = default;
+    ~ResistorStore() = default;
+
+    /**
+     * @brief Gets the number of resistors.
+     *
+     * @return uint64_t - number of resistors.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Reserves memory for the resistors.
+     *
+     * @param t_size expected number of resistors.
+     */
+    void reserve(const uint64_t& t_size);
+
+    /**
+     * @brief Releases memory reserved over the number of resistors.
+     *
+     */
+    void shrinkToFit();
+
+    /**
+     * @brief Appends a resistor.
+     *
+     * @param t_firstNode id of the first node.
+     * @param t_secondNode id of the second node.
+     * @param t_value resistance.
+     * @param t_name name of the resistor.
+     * @return uint64_t - id of the resistor.
+     */
+    uint64_t add(const uint64_t& t_firstNode, const uint64_t& t_secondNode, const Value& t_value,
+        const std::string_view& t_name);
+
+    /**
+     * @brief Gets the name of the resistor.
+     *
+     * @param t_id id of the resistor.
+     * @return std::string_view - name of the resistor, valid until the next resistor is added.
+     */
+    std::string_view getName(const uint64_t& t_id) const;
 
     /**
-     * @brief Disconnects the resistor from all other elements.
+     * @brief Gets the memory held by the fields of the resistors.
      *
+     * @return uint64_t - size in bytes.
      */
-    void fullyDisconnection();
+    uint64_t memorySize() const;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,98 @@
+#ifndef STENCIL_GRID_H
+#define STENCIL_GRID_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+#include "node.h"
+
+/**
+ * @brief Regular lattice of one metal layer stored as a dense 2D array. Cell (x, y) is the row firstRow + y * width + x,
+ * its neighbors in the layer are the cells at fixed offsets -1, +1, -width and +width. The matrix is symmetric, so only
+ * conductances to east and north neighbors are kept, the west one of a cell is the east one of the previous cell.
+ * Arrays of directions without conductances, as north ones of horizontal stripes, are empty. Entries of rows of the
+ * region which are not stencil neighbors, as vias, stay in sparse form.
+ *
+ */
+struct StencilRegion {
+    L layer {};
+    uint64_t firstRow {};
+    uint64_t width {};
+    uint64_t height {};
+    std::vector<Value> eastConductances {};
+    std::vector<Value> northConductances {};
+    std::vector<uint64_t> extraOffsets {};
+    std::vector<uint64_t> extraColumns {};
+    std::vector<Value> extraConductances {};
+};
+
+/**
+ * @brief Regular lattices of layers of the conductance matrix. Rows of lattices are the first rows of the matrix, so
+ * the values of the state are the dense arrays of lattices, and the rest of rows follow them.
+ *
+ * A sweep relaxes every lattice by red-black gauss-seidel with vector kernels, then the rest of rows by gauss-seidel.
+ * Black cells of a line are relaxed right after red cells of the next line, so a line is swept twice while it is in the
+ * cache.
+ */
+class StencilGrid {
+public:
+    std::vector<StencilRegion> regions {};
+    uint64_t stencilRowsSize {};
+
+public:
+    StencilGrid() = default;
+    ~StencilGrid() = default;
+
+    /**
+     * @brief Finds regular lattices among the rows. Nodes of one layer are split into lines of the same y, runs of
+     * consecutive lines with the same xs form one lattice.
+     *
+     * @param t_nodes store of the nodes.
+     * @param t_rowNodes ids of nodes of rows in their order.
+     * @return std::vector<uint64_t> - ids of nodes of rows: cells of lattices line by line, then the rest of rows in
+     * their order.
+     */
+    std::vector<uint64_t> detect(const NodeStore& t_nodes, const std::vector<uint64_t>& t_rowNodes);
+
+    /**
+     * @brief Splits entries of rows of lattices into stencils and sparse entries.
+     *
+     * @param t_matrix conductance matrix built in the order of detected rows.
+     */
+    void build(const ConductanceMatrix& t_matrix);
+
+    /**
+     * @brief Makes one sweep over all rows.
+     *
+     * @param t_matrix conductance matrix.
+     * @param t_state currents and values of the rows.
+     * @param t_precision max change of the row value to count it as solved.
+     * @return uint64_t - number of solved rows.
+     */
+    uint64_t step(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision) const;
+
+    /**
+     * @brief Gets the number of entries of stencils.
+     *
+     * @return uint64_t - number of non zero conductances of stencils.
+     */
+    uint64_t stencilEntriesSize() const;
+
+    /**
+     * @brief Gets the memory held by the lattices.
+     *
+     * @return uint64_t - size in bytes.
+     */
+    uint64_t memorySize() const;
+};
+
+#endif
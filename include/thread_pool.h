@@ -0,0 +1,56 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+// STL Libs
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed set of worker threads running parallel loops. The calling thread takes part in every loop.
+ *
+ */
+class ThreadPool {
+    std::vector<std::thread> m_threads {};
+    std::mutex m_mutex {};
+    std::condition_variable m_startCondition {};
+    std::condition_variable m_doneCondition {};
+    std::function<void(uint64_t)> m_task {};
+    uint64_t m_generation {};
+    uint64_t m_pendingThreads {};
+    bool m_isStopping {};
+
+public:
+    ThreadPool(const uint64_t& t_size);
+    ~ThreadPool();
+
+    /**
+     * @brief Gets the number of threads including the calling one.
+     *
+     * @return uint64_t - number of threads.
+     */
+    uint64_t size() const;
+
+    /**
+     * @brief Splits [t_begin, t_end) into one contiguous chunk per thread and waits for all of them.
+     *
+     * @param t_begin first index of the range.
+     * @param t_end end of the range.
+     * @param t_function function called as (chunk begin, chunk end, thread index).
+     */
+    void parallelFor(const uint64_t& t_begin, const uint64_t& t_end,
+        const std::function<void(uint64_t, uint64_t, uint64_t)>& t_function);
+
+private:
+    /**
+     * @brief Loop of the worker thread.
+     *
+     * @param t_threadIndex index of the thread, the calling thread has index 0.
+     */
+    void workerLoop(const uint64_t t_threadIndex);
+};
+
+#endif
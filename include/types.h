@@ -1,7 +1,11 @@
+#ifndef TYPES_H
+#define TYPES_H
+
 class Node;
 class Resistor;
 class CurrentSource;
 class VoltageSource;
+class BufferedWriter;
 
 using L = uint8_t;
 using X = uint32_t;
@@ -10,11 +14,15 @@ using Value = double;
 using Name = std::string;
 using NodeCoords = std::array<uint32_t, 3>;
 
-using NodePtr = std::shared_ptr<Node>;
-using ResistorPtr = std::shared_ptr<Resistor>;
 using CurrentSourcePtr = std::shared_ptr<CurrentSource>;
 using VoltageSourcePtr = std::shared_ptr<VoltageSource>;
-using NodePtrVec = std::vector<NodePtr>;
-using ResistorPtrVec = std::vector<ResistorPtr>;
 using CurrentSourcePtrVec = std::vector<CurrentSourcePtr>;
-using VoltageSourcePtrVec = std::vector<VoltageSourcePtr>;
\ No newline at end of file
+using VoltageSourcePtrVec = std::vector<VoltageSourcePtr>;
+
+enum class SolverType { GaussSeidel, PCG, Cholesky, Multigrid, Local, Stencil };
+enum class PreconditionerType { Jacobi, IncompleteCholesky, Multigrid };
+enum class OrderingType { Netlist, Morton, Hilbert, ReverseCuthillMcKee };
+enum class SimdType { Scalar, AVX2, AVX512 };
+enum class PrecisionType { Double, Float };
+
+#endif
\ No newline at end of file
@@ -0,0 +1,174 @@
+#ifndef VECTOR_KERNELS_H
+#define VECTOR_KERNELS_H
+
+// STL Libs
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Types
+#include "types.h"
+
+// Project Libs
+#include "conductance_matrix.h"
+#include "stencil_grid.h"
+
+/**
+ * @brief Kernels of solvers and statistics over contiguous arrays with scalar, AVX2 and AVX-512 versions. The widest
+ * version supported by the cpu is selected at runtime, other cpus and compilers use the scalar version. Vector
+ * versions of matrix kernels run over slices of rows of the matrix, every lane holds one row and gathers values of its
+ * neighbors.
+ *
+ * Vector versions sum in a different order than the scalar one, so results may differ in the last bits.
+ */
+class VectorKernels {
+public:
+    /**
+     * @brief Finds the widest version of kernels supported by the cpu and the compiler.
+     *
+     * @return SimdType - widest supported version.
+     */
+    static SimdType detectSimdType();
+
+    /**
+     * @brief Gets the version of kernels in use.
+     *
+     * @return SimdType - version in use.
+     */
+    static SimdType getSimdType();
+
+    /**
+     * @brief Sets the version of kernels in use, it must be set before kernels run in other threads.
+     *
+     * @param t_simdType version to use, it must be supported.
+     */
+    static void setSimdType(const SimdType& t_simdType);
+
+    /**
+     * @brief Sets the version of kernels in use by its name.
+     *
+     * @param t_simd name of the version: 'auto', 'scalar', 'avx2' or 'avx512'.
+     */
+    static void setSimd(const std::string& t_simd);
+
+    /**
+     * @brief Gets the name of the version of kernels.
+     *
+     * @param t_simdType version of kernels.
+     * @return std::string - name of the version.
+     */
+    static std::string getSimdName(const SimdType& t_simdType);
+
+    /**
+     * @brief Dot product of two arrays.
+     *
+     * @param t_first first array.
+     * @param t_second second array.
+     * @param t_size size of arrays.
+     * @return Value - dot product.
+     */
+    static Value dot(const Value* t_first, const Value* t_second, const uint64_t& t_size);
+
+    /**
+     * @brief Adds the scaled source to the target: target = target + scale * source.
+     *
+     * @param t_target array to update.
+     * @param t_source array to add.
+     * @param t_scale scale of the source.
+     * @param t_size size of arrays.
+     */
+    static void addScaled(Value* t_target, const Value* t_source, const Value& t_scale, const uint64_t& t_size);
+
+    /**
+     * @brief Scales the target and adds the source: target = source + scale * target.
+     *
+     * @param t_target array to update.
+     * @param t_source array to add.
+     * @param t_scale scale of the target.
+     * @param t_size size of arrays.
+     */
+    static void scaleAndAdd(Value* t_target, const Value* t_source, const Value& t_scale, const uint64_t& t_size);
+
+    /**
+     * @brief Multiplies two arrays element by element: target = first * second.
+     *
+     * @param t_target array of products.
+     * @param t_first first array.
+     * @param t_second second array.
+     * @param t_size size of arrays.
+     */
+    static void multiplyElements(Value* t_target, const Value* t_first, const Value* t_second, const uint64_t& t_size);
+
+    /**
+     * @brief Multiplies the matrix by the vector: result[i] = diagonal[i] * v[i] - sum(conductances * v).
+     *
+     * @param t_matrix conductance matrix with built slices.
+     * @param t_vector vector to multiply, one value per row.
+     * @param t_result result of multiplication, one value per row.
+     */
+    static void multiply(const ConductanceMatrix& t_matrix, const Value* t_vector, Value* t_result);
+
+    /**
+     * @brief Relaxes rows of the slices by the jacobi update of their values in place. Slices must be of one color,
+     * so their rows are not neighbors and the update is the gauss-seidel one.
+     *
+     * @param t_matrix conductance matrix with built slices.
+     * @param t_state currents and values of the rows.
+     * @param t_sliceBegin first slice.
+     * @param t_sliceEnd slice after the last one.
+     * @param t_precision max change of the row value to count it as solved.
+     * @return uint64_t - number of solved rows.
+     */
+    static uint64_t relaxSlices(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+        const uint64_t& t_sliceBegin, const uint64_t& t_sliceEnd, const Value& t_precision);
+
+    /**
+     * @brief Relaxes cells of one color, parity of x + y, in one line of the lattice in place. Cells of one color are
+     * not neighbors in the lattice, so lanes relax independent cells.
+     *
+     * @param t_region lattice of the cells.
+     * @param t_matrix conductance matrix built in the order of the lattice.
+     * @param t_state currents and values of the rows.
+     * @param t_couplings sums of currents and sparse entries of cells of the lattice.
+     * @param t_y line of the cells.
+     * @param t_color color of the cells.
+     * @param t_precision max change of the row value to count it as solved.
+     * @return uint64_t - number of solved rows.
+     */
+    static uint64_t relaxStencilLine(const StencilRegion& t_region, const ConductanceMatrix& t_matrix,
+        ConductanceState& t_state, const Value* t_couplings, const uint64_t& t_y, const uint64_t& t_color,
+        const Value& t_precision);
+
+    /**
+     * @brief Calculates the max, min and sum of ir-drops of nodes without skipped flags.
+     *
+     * @param t_values voltages of nodes.
+     * @param t_flags flags of nodes.
+     * @param t_skippedFlags nodes with any of these flags are skipped.
+     * @param t_voltage voltage of voltage sources.
+     * @param t_size number of nodes.
+     * @return std::array<Value, 3> - max, min and sum of ir-drops, max starts from zero and min from the voltage.
+     */
+    static std::array<Value, 3> calculateIRDrop(const Value* t_values, const uint8_t* t_flags,
+        const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size);
+
+    /**
+     * @brief Sums differences of voltages relative to real ir-drops of nodes without skipped flags:
+     * sum(|(real - value) / (voltage - real)|).
+     *
+     * @param t_values voltages of nodes.
+     * @param t_realValues real voltages of nodes.
+     * @param t_flags flags of nodes.
+     * @param t_skippedFlags nodes with any of these flags are skipped.
+     * @param t_voltage voltage of voltage sources.
+     * @param t_size number of nodes.
+     * @param t_count number of summed nodes.
+     * @return Value - sum of relative differences.
+     */
+    static Value sumRelativeDifferences(const Value* t_values, const Value* t_realValues, const uint8_t* t_flags,
+        const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size, uint64_t& t_count);
+};
+
+#endif
@@ -15,7 +15,8 @@ class VoltageSource {
 public:
     Value value {};
     Name name {};
-    NodePtr connectedNode;
+    // Id of the node the voltage source is connected to
+    uint64_t connectedNode {};
 
 private:
     L m_layer {};
@@ -35,10 +36,11 @@ public:
     std::string toString();
 
     /**
-     * @brief Disconnects the voltage source from all other elements.
+     * @brief Writes line description of the voltage source in spice format, same as toString.
      *
+     * @param t_writer writer to write to.
      */
-    void fullyDisconnection();
+    void write(BufferedWriter& t_writer) const;
 };
 
 #endif
\ No newline at end of file
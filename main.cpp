@@ -3,114 +3,527 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <exception>
 #include <filesystem>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
 #include <unordered_map>
 
 // Project libs
 #include "include/config.h"
+#include "include/dataset_archive.h"
+#include "include/output_pipeline.h"
 #include "include/pdn_container.h"
+#include "include/rasterizer.h"
+#include "include/vector_kernels.h"
 
 #define __PROJECT_VERSION__ "v0.0.1"
-#define __DEFAULT_METHODS_STEP__ 0.01
-#define __METHODS_STEP_CHANGE_BY__ 0.001
-#define __BOTTOM_BORDER__ 0.9
+#define __MAX_THREADS__ 1024
+#define __MAX_SEARCH_SOLVES__ 16
+#define __MIN_SEARCH_FRACTION__ 1e-4
+#define __MIN_SEARCH_GROWTH__ 1.25
+#define __MAX_SEARCH_GROWTH__ 4.0
+#define __SEARCH_BISECTION_MARGIN__ 0.1
+#define __BASE_NETLIST_NAME__ "netlist-base.sp"
+#define __ARCHIVE_EXTENSION__ ".pdna"
+
+/**
+ * @brief Result of generation of one fake.
+ *
+ */
+struct FakeStatistics {
+    Value meanDifference {};
+    Value verificationError {};
+    std::array<Value, 3> irDrops {};
+    uint32_t totalSteps {};
+    uint64_t totalIterations {};
+    uint64_t solvingDuration {};
+    uint64_t snapshotDuration {};
+    uint64_t outputDuration {};
+    uint64_t duration {};
+};
+
+/**
+ * @brief Changes the pdn until its ir-drop differs enough from the original one and hands its snapshot to writers.
+ *
+ * @param t_pdnContainer pdn to change.
+ * @param t_outputPipeline writers of the fake.
+ * @param t_config configuration of the generator.
+ * @param t_index index of the fake.
+ * @param t_isVerbose prints every step of the generation.
+ * @return FakeStatistics - result of the generation.
+ */
+static FakeStatistics generateFake(PDNContainer& t_pdnContainer, OutputPipeline& t_outputPipeline, const Config& t_config, const size_t& t_index,
+    const bool& t_isVerbose)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    Value irDropDiffStep = (t_config.irDropDiff) / t_config.numOfFakes;
+    Value target = irDropDiffStep * (t_index + 1);
+    Value min = target * (1 - t_config.tolerance);
+    Value max = target * (1 + t_config.tolerance);
+    FakeStatistics statistics {};
+
+    if (t_isVerbose)
+        std::cout << "\nCreating: netlist-fake-" << t_index << "\n"
+                  << std::flush;
+
+    // Changes the pdn by the fraction of current sources
+    auto place = [&](const Value& t_fraction) {
+        switch (t_config.mode) {
+        case 1:
+            t_pdnContainer.inverseCurrentSourcesPositions(t_fraction);
+            break;
+        case 2:
+            if (t_config.isGuided)
+                t_pdnContainer.connectGuidedCurrentSources(t_fraction);
+            else
+                t_pdnContainer.connectFakeCurrentSources(t_fraction);
+            break;
+        case 3:
+            // Ir-drop is linear in currents, so the target difference is reached at once from the real solution
+            t_pdnContainer.scaleIRDrop(irDropDiffStep * (t_index + 1));
+            break;
+        default:
+            break;
+        }
+    };
+
+    // Changes the pdn by the fraction of current sources, solves it and returns the ir-drop difference
+    auto step = [&](const Value& t_fraction) {
+        place(t_fraction);
+
+        if (t_config.mode != 3)
+            statistics.totalIterations += t_pdnContainer.solveDC(t_config.irDropPrecision, t_config.maxIterations);
+        else if (t_config.isVerified)
+            statistics.totalIterations += t_pdnContainer.verifyIRDrop(t_config.irDropPrecision, t_config.maxIterations,
+                statistics.verificationError);
+
+        statistics.meanDifference = t_pdnContainer.compareFakeWithRealValues();
+        statistics.irDrops = t_pdnContainer.calculateIRDrop();
+        ++statistics.totalSteps;
+
+        if (t_isVerbose) {
+            std::cout << "Step: " << statistics.totalSteps
+                      << " -- Fraction: " << t_fraction
+                      << " -- Total iterations: " << statistics.totalIterations;
+
+            if (t_config.solver != "gs" && t_config.solver != "stencil")
+                std::cout << " -- Residual: " << t_pdnContainer.getLastResidual();
+
+            if (t_config.mode == 3 && t_config.isVerified)
+                std::cout << " -- Verification error: " << statistics.verificationError;
+
+            std::cout << " -- IR-Drop difference: " << statistics.meanDifference * 100.0 << "%"
+                      << " -- Max: " << statistics.irDrops[0]
+                      << " -- Min: " << statistics.irDrops[1]
+                      << " -- Mean: " << statistics.irDrops[2] << "\r" << std::flush;
+        }
+
+        return statistics.meanDifference;
+    };
+
+    if (t_config.mode == 3) {
+        step(0);
+    } else {
+        // Bracketing secant search on the fraction of changed current sources, every trial starts from the placement and
+        // the solution of the checkpoint, so its difference depends on its fraction only.
+        // If even the whole fraction stays below the band, its result is kept and the search starts again from it.
+        bool isFound {};
+
+        while (!isFound) {
+            auto checkpoint = t_pdnContainer.createCheckpoint(true);
+            Value startDifference = t_pdnContainer.compareFakeWithRealValues();
+
+            Value lowFraction {};
+            Value lowDifference = startDifference;
+            Value highFraction {};
+            Value highDifference {};
+            bool isBracketed {};
+            bool isExhausted {};
+            Value bestFraction {};
+            Value bestDifference {};
+            uint32_t bestSolve {};
+            PDNCheckpoint bestCheckpoint {};
+            Value fraction = std::clamp(target - startDifference, __MIN_SEARCH_FRACTION__, 1.0);
+
+            for (uint32_t solves {}; !isFound; ++solves) {
+                if (solves == __MAX_SEARCH_SOLVES__) {
+                    isExhausted = true;
+                    break;
+                }
+
+                if (solves > 0)
+                    t_pdnContainer.restoreCheckpoint(checkpoint);
+
+                Value difference = step(fraction);
+
+                // Solution of the closest trial is saved in case solves run out
+                bool isInBand = difference >= min && difference <= max;
+
+                if (!isInBand && (solves == 0 || std::fabs(difference - target) < std::fabs(bestDifference - target))) {
+                    bestFraction = fraction;
+                    bestDifference = difference;
+                    bestSolve = solves;
+                    bestCheckpoint = t_pdnContainer.createCheckpoint(true);
+                }
+
+                if (isInBand) {
+                    isFound = true;
+                } else if (difference < min) {
+                    lowFraction = fraction;
+                    lowDifference = difference;
+
+                    if (!isBracketed && fraction >= 1)
+                        break;
+                } else {
+                    highFraction = fraction;
+                    highDifference = difference;
+                    isBracketed = true;
+                }
+
+                if (isFound)
+                    break;
+
+                if (isBracketed) {
+                    // Regula falsi inside the bracket, bisection if it does not move away from the ends
+                    Value next = lowFraction
+                        + (target - lowDifference) * (highFraction - lowFraction) / (highDifference - lowDifference);
+                    Value margin = (highFraction - lowFraction) * __SEARCH_BISECTION_MARGIN__;
+
+                    fraction = next > lowFraction + margin && next < highFraction - margin
+                        ? next
+                        : (lowFraction + highFraction) / 2;
+                } else {
+                    // Secant through the start and the last trial, growth is limited until the target is bracketed
+                    Value next = difference > startDifference
+                        ? fraction * (target - startDifference) / (difference - startDifference)
+                        : fraction * __MAX_SEARCH_GROWTH__;
+
+                    fraction = std::min(1.0, std::clamp(next, fraction * __MIN_SEARCH_GROWTH__, fraction * __MAX_SEARCH_GROWTH__));
+                }
+            }
+
+            // Out of solves, the closest trial is taken. Its placement is repeated from the checkpoint, so the saved
+            // solution of the trial is valid for it.
+            if (isExhausted && isBracketed) {
+                if (bestSolve + 1 != __MAX_SEARCH_SOLVES__) {
+                    t_pdnContainer.restoreCheckpoint(checkpoint);
+                    place(bestFraction);
+                    t_pdnContainer.restoreCheckpoint(bestCheckpoint);
+
+                    statistics.meanDifference = bestDifference;
+                    statistics.irDrops = t_pdnContainer.calculateIRDrop();
+                }
+
+                std::ostringstream warning {};
+                warning << "\nWarning: netlist-fake-" << t_index << " -- IR-Drop difference: " << bestDifference * 100.0
+                        << "% is out of the tolerance of the target: " << target * 100.0 << "%\n";
+                std::cerr << warning.str() << std::flush;
+
+                isFound = true;
+            }
+        }
+    }
+
+    if (t_isVerbose)
+        std::cout << std::endl;
+
+    auto snapshotStart = std::chrono::high_resolution_clock::now();
+
+    std::ostringstream fakeFolderName;
+    fakeFolderName << t_config.destination + "/netlist-fake-"
+                   << "mode-" << static_cast<uint32_t>(t_config.mode) << "-" << t_index;
+
+    // Fakes of the archive are stored in one file and do not need folders
+    if (t_config.archive == 0)
+        std::filesystem::create_directory(fakeFolderName.str());
+
+    std::ostringstream spiceFileName;
+    spiceFileName << fakeFolderName.str() + "/netlist.sp";
+
+    std::ostringstream irdropFileName;
+    irdropFileName << fakeFolderName.str() + "/netlist.csv";
+
+    auto snapshot = t_pdnContainer.createSnapshot(spiceFileName.str(), irdropFileName.str(),
+        t_config.isDelta ? std::string("../") + __BASE_NETLIST_NAME__ : std::string());
+    snapshot->fakeIndex = t_index;
+
+    if (t_config.mapBin != 0)
+        snapshot->mapsFolderName = fakeFolderName.str();
+    auto outputStart = std::chrono::high_resolution_clock::now();
+    t_outputPipeline.push(std::move(snapshot));
+
+    auto end = std::chrono::high_resolution_clock::now();
+    statistics.solvingDuration = std::chrono::duration_cast<std::chrono::microseconds>(snapshotStart - start).count();
+    statistics.snapshotDuration = std::chrono::duration_cast<std::chrono::microseconds>(outputStart - snapshotStart).count();
+    statistics.outputDuration = std::chrono::duration_cast<std::chrono::microseconds>(end - outputStart).count();
+    statistics.duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    if (t_isVerbose)
+        std::cout << "Time of solving: " << statistics.solvingDuration / 1000 << " ms"
+                  << " -- Time of snapshot: " << statistics.snapshotDuration / 1000 << " ms"
+                  << " -- Time of output: " << statistics.outputDuration / 1000 << " ms\n"
+                  << std::flush;
+
+    return statistics;
+}
+
+/**
+ * @brief Extracts the fake from the archive to its folder in the destination, the netlist of the fake includes the
+ * base netlist written next to the archive.
+ *
+ * @param t_config configuration of the generator.
+ */
+static void extractFromArchive(const Config& t_config)
+{
+    DatasetArchiveReader archive(t_config.source);
+
+    std::cout << "Archive - " << t_config.source << "\n"
+              << "- Total fakes: " << archive.size() << "\n"
+              << "- Mode: " << static_cast<uint32_t>(archive.getMode()) << "\n"
+              << std::flush;
+
+    std::ostringstream fakeFolderName;
+    fakeFolderName << t_config.destination + "/netlist-fake-"
+                   << "mode-" << static_cast<uint32_t>(archive.getMode()) << "-" << t_config.extractIndex;
+    std::filesystem::create_directories(fakeFolderName.str());
+
+    auto baseNetlistName = std::filesystem::path(t_config.source).parent_path() / __BASE_NETLIST_NAME__;
+    auto baseNetlistInclude = std::filesystem::relative(baseNetlistName, fakeFolderName.str()).generic_string();
+
+    uint64_t totalLines = archive.extract(t_config.extractIndex, fakeFolderName.str() + "/netlist.sp",
+        fakeFolderName.str() + "/netlist.csv", baseNetlistInclude);
+
+    std::cout << "\nExtracted: " << fakeFolderName.str() << " -- Lines: " << totalLines << "\n"
+              << std::flush;
+}
 
 int main(int args, const char* argv[])
 {
     Config config(args, argv);
 
-    if (!config.isHelp) {
+    if (!config.isHelp && config.isExtract) {
+        std::cout << "C++ Standard 20\nSpice Fake Generator " << __PROJECT_VERSION__
+                  << "\n================================================================================\n\n"
+                  << std::flush;
+
+        try {
+            extractFromArchive(config);
+        } catch (std::exception& e) {
+            std::cerr << "\nArchive error: " << e.what() << "\n";
+        }
+
+        std::cout
+            << "\n================================================================================\nEnd of extracting.\n"
+            << std::flush;
+    } else if (!config.isHelp) {
 
         std::cout << "C++ Standard 20\nSpice Fake Generator " << __PROJECT_VERSION__
                   << "\n================================================================================\n\n"
                   << std::flush;
 
         try {
-            Value irDropDiffStep = (config.irDropDiff) / config.numOfFakes;
             uint64_t sumTimeOfGeneration {};
+            uint64_t sumTimeOfSolving {};
+            uint64_t sumTimeOfSnapshots {};
             Value sumOfPercentageDifferences {};
+            Value maxVerificationError {};
             std::array<Value, 3> sumOfFakeIRDrops {};
+            uint64_t sumOfSolves {};
+            std::vector<FakeStatistics> fakesStatistics(config.numOfFakes);
+
+            if (config.archive != 0 && config.archive != 32 && config.archive != 64)
+                throw std::invalid_argument("Archive precision must be 0, 32 or 64");
+
+            if (config.mode == 3 && 1 + config.irDropDiff <= 0)
+                throw std::invalid_argument("IR-drop difference of mode 3 must be above -1");
+
+            if ((config.mode == 1 || config.mode == 2) && config.irDropDiff < 0)
+                throw std::invalid_argument("IR-drop difference of modes 1 and 2 must not be negative");
+
+            if (config.tolerance < 0 || config.tolerance >= 1)
+                throw std::invalid_argument("Tolerance must be in [0, 1)");
 
-            PDNContainer pdnContainer(config.source);
+            if (config.archive != 0 && config.mapBin != 0)
+                throw std::invalid_argument("Maps can not be written to the archive");
+
+            if (config.isGuided && config.mode != 2)
+                throw std::invalid_argument("Guided placement is supported in mode 2 only");
+
+            // Negative counts wrap around in unsigned parsing, so they are above the max as well
+            if (config.threads < 1 || config.threads > __MAX_THREADS__)
+                throw std::invalid_argument("Number of threads must be in [1, " + std::to_string(__MAX_THREADS__) + "]");
+
+            if (config.jobs > __MAX_THREADS__)
+                throw std::invalid_argument("Number of jobs must be in [0, " + std::to_string(__MAX_THREADS__) + "]");
+
+            if (!config.isSeed) {
+                std::random_device rng {};
+                config.seed = (static_cast<uint64_t>(rng()) << 32) | rng();
+            }
+
+            VectorKernels::setSimd(config.simd);
+
+            PDNContainer pdnContainer(config.source, config.isCached);
+            pdnContainer.setOrdering(config.ordering);
+            pdnContainer.setSolver(config.solver, config.preconditioner);
+            pdnContainer.setWorkingPrecision(config.workingPrecision);
+            pdnContainer.setThreads(config.threads);
+            pdnContainer.setSeed(config.seed);
 
             pdnContainer.solveDCAndSaveRealValues(config.irDropPrecision, config.maxIterations);
 
-            for (size_t i = 0; i < config.numOfFakes; ++i) {
-                auto start = std::chrono::high_resolution_clock::now();
-                auto min = std::fabs((irDropDiffStep * __BOTTOM_BORDER__) * (i + 1));
-                bool positive = static_cast<bool>(irDropDiffStep > 0);
-                bool negative = static_cast<bool>(irDropDiffStep < 0);
-                uint32_t totalSteps {};
-                uint32_t totalIterations {};
-                Value meanDifference {};
-                Value methodsStep = __DEFAULT_METHODS_STEP__ * irDropDiffStep;
-                std::array<Value, 3> fakeIRDrops {};
-
-                std::cout << "\nCreating: netlist-fake-" << i << "\n"
+            if (config.isBenchmark)
+                pdnContainer.benchmarkKernels();
+
+            // Sensitivities depend on the real solution only, forks of the pdn copy them
+            if (config.isGuided) {
+                auto sensitivitiesStart = std::chrono::high_resolution_clock::now();
+                uint64_t sensitivitiesIterations = pdnContainer.calculateSensitivities(config.irDropPrecision,
+                    config.maxIterations);
+                auto sensitivitiesEnd = std::chrono::high_resolution_clock::now();
+
+                std::cout << "\nSensitivities -- Iterations: " << sensitivitiesIterations
+                          << " -- Time of solving: "
+                          << std::chrono::duration_cast<std::chrono::milliseconds>(sensitivitiesEnd - sensitivitiesStart).count()
+                          << " ms\n"
                           << std::flush;
+            }
 
-                do {
-                    switch (config.mode) {
-                    case 1:
-                        pdnContainer.inverseCurrentSourcesPositions(methodsStep);
-                        break;
-                    case 2:
-                        pdnContainer.connectFakeCurrentSources(methodsStep);
-                        break;
-                    case 3:
-                        pdnContainer.changeCurrentSourceValue(methodsStep);
-                        break;
-                    default:
-                        break;
-                    }
+            std::cout << "\nSeed: " << config.seed << "\n"
+                      << "SIMD: " << VectorKernels::getSimdName(VectorKernels::getSimdType()) << "\n"
+                      << std::flush;
 
-                    totalIterations += pdnContainer.solveDC(config.irDropPrecision, config.maxIterations);
-                    meanDifference = pdnContainer.compareFakeWithRealValues();
-                    fakeIRDrops = pdnContainer.calculateIRDrop();
+            if (!std::filesystem::exists(config.destination))
+                std::filesystem::create_directories(config.destination);
 
-                    std::cout << "Step: " << ++totalSteps
-                              << " -- Total iterations: " << totalIterations
-                              << " -- IR-Drop difference: " << meanDifference * 100.0 << "%"
-                              << " -- Max: " << fakeIRDrops[0]
-                              << " -- Min: " << fakeIRDrops[1]
-                              << " -- Mean: " << fakeIRDrops[2] << "\r" << std::flush;
+            if (config.isDelta || config.archive != 0) {
+                auto baseStart = std::chrono::high_resolution_clock::now();
+                uint64_t baseLines = pdnContainer.writeBaseNetlistToFile(config.destination + "/" + __BASE_NETLIST_NAME__);
+                auto baseEnd = std::chrono::high_resolution_clock::now();
 
-                    if (meanDifference >= min) {
-                        std::cout << std::endl;
-                        break;
+                std::cout << "\nBase netlist: " << __BASE_NETLIST_NAME__ << " -- Lines: " << baseLines
+                          << " -- Time of writing: " << std::chrono::duration_cast<std::chrono::milliseconds>(baseEnd - baseStart).count()
+                          << " ms\n"
+                          << std::flush;
+            }
+
+            std::unique_ptr<DatasetArchiveWriter> archive {};
+
+            if (config.archive != 0) {
+                std::ostringstream archiveFileName;
+                archiveFileName << config.destination + "/dataset-mode-" << static_cast<uint32_t>(config.mode)
+                                << __ARCHIVE_EXTENSION__;
+
+                archive = std::make_unique<DatasetArchiveWriter>(archiveFileName.str(), *pdnContainer.getTopology(),
+                    config.mode, config.archive == 32);
+
+                std::cout << "\nArchive: " << archiveFileName.str() << "\n"
+                          << std::flush;
+            }
+
+            std::unique_ptr<Rasterizer> rasterizer {};
+
+            if (config.mapBin != 0) {
+                auto mapsStart = std::chrono::high_resolution_clock::now();
+                rasterizer = std::make_unique<Rasterizer>(*pdnContainer.getTopology(), config.mapBin, config.threads);
+                rasterizer->writeResistanceMaps(config.destination);
+                auto mapsEnd = std::chrono::high_resolution_clock::now();
+
+                std::cout << "\nMaps: " << rasterizer->width() << "x" << rasterizer->height()
+                          << " bins -- Layers: " << rasterizer->getLayers().size()
+                          << " -- Time of resistance maps: " << std::chrono::duration_cast<std::chrono::milliseconds>(mapsEnd - mapsStart).count()
+                          << " ms\n"
+                          << std::flush;
+            }
+
+            OutputPipeline outputPipeline(config.writers, config.writeQueue, archive.get(), rasterizer.get());
+            auto start = std::chrono::high_resolution_clock::now();
+
+            if (config.jobs == 0) {
+                // Every fake continues changing the previous one
+                for (size_t i = 0; i < config.numOfFakes; ++i)
+                    fakesStatistics[i] = generateFake(pdnContainer, outputPipeline, config, i, true);
+            } else {
+                // Every fake is generated from the original pdn seeded by its index, every job copies the pdn once
+                // and rolls it back to the original between fakes
+                std::atomic<size_t> nextFake {};
+                std::mutex outputMutex {};
+                std::exception_ptr exception {};
+                std::vector<std::thread> workers {};
+
+                std::cout << "\nGenerating " << config.numOfFakes << " fakes in " << config.jobs << " jobs\n"
+                          << std::flush;
+
+                auto work = [&]() {
+                    std::unique_ptr<PDNContainer> fakeContainer {};
+                    PDNCheckpoint original {};
+
+                    for (size_t i = nextFake++; i < config.numOfFakes; i = nextFake++) {
+                        try {
+                            if (!fakeContainer) {
+                                fakeContainer = pdnContainer.fork(config.seed + i);
+                                original = fakeContainer->createCheckpoint(true);
+                            } else {
+                                fakeContainer->restoreCheckpoint(original);
+                                fakeContainer->setSeed(config.seed + i);
+                            }
+
+                            fakesStatistics[i] = generateFake(*fakeContainer, outputPipeline, config, i, false);
+
+                            std::lock_guard<std::mutex> lock(outputMutex);
+                            std::cout << "Created: netlist-fake-" << i
+                                      << " -- Solves: " << fakesStatistics[i].totalSteps
+                                      << " -- Total iterations: " << fakesStatistics[i].totalIterations
+                                      << " -- IR-Drop difference: " << fakesStatistics[i].meanDifference * 100.0 << "%"
+                                      << " -- Time: " << fakesStatistics[i].duration << " ms\n"
+                                      << std::flush;
+                        } catch (...) {
+                            std::lock_guard<std::mutex> lock(outputMutex);
+
+                            if (!exception)
+                                exception = std::current_exception();
+
+                            nextFake = config.numOfFakes;
+                        }
                     }
+                };
 
-                    methodsStep -= methodsStep * __METHODS_STEP_CHANGE_BY__;
-                } while (true);
+                for (size_t i = 1; i < std::min<size_t>(config.jobs, config.numOfFakes); ++i)
+                    workers.emplace_back(work);
 
-                sumOfFakeIRDrops[0] += fakeIRDrops[0];
-                sumOfFakeIRDrops[1] += fakeIRDrops[1];
-                sumOfFakeIRDrops[2] += fakeIRDrops[2];
+                work();
 
-                if (!std::filesystem::exists(config.destination))
-                    std::filesystem::create_directories(config.destination);
+                for (auto& worker : workers)
+                    worker.join();
 
-                std::ostringstream fakeFolderName;
-                fakeFolderName << config.destination + "/netlist-fake-"
-                               << "mode-" << static_cast<uint32_t>(config.mode) << "-" << i;
-                std::filesystem::create_directory(fakeFolderName.str());
+                if (exception)
+                    std::rethrow_exception(exception);
+            }
 
-                std::ostringstream spiceFileName;
-                spiceFileName << fakeFolderName.str() + "/netlist.sp";
-                pdnContainer.writeNetlistToFile(spiceFileName.str());
+            outputPipeline.finish();
 
-                std::ostringstream irdropFileName;
-                irdropFileName << fakeFolderName.str() + "/netlist.csv";
-                pdnContainer.writeIRDropToFile(irdropFileName.str());
+            if (archive && !archive->close())
+                std::cerr << "\nFailed to write archive\n";
 
-                auto end = std::chrono::high_resolution_clock::now();
-                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+            auto end = std::chrono::high_resolution_clock::now();
+            auto wallTimeOfGeneration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
 
-                sumTimeOfGeneration += duration;
-                sumOfPercentageDifferences += meanDifference;
+            for (const auto& fakeStatistics : fakesStatistics) {
+                sumOfFakeIRDrops[0] += fakeStatistics.irDrops[0];
+                sumOfFakeIRDrops[1] += fakeStatistics.irDrops[1];
+                sumOfFakeIRDrops[2] += fakeStatistics.irDrops[2];
+                sumTimeOfGeneration += fakeStatistics.duration;
+                sumTimeOfSolving += fakeStatistics.solvingDuration;
+                sumTimeOfSnapshots += fakeStatistics.snapshotDuration;
+                sumOfPercentageDifferences += fakeStatistics.meanDifference;
+                sumOfSolves += fakeStatistics.totalSteps;
+                maxVerificationError = std::max(maxVerificationError, fakeStatistics.verificationError);
             }
 
             std::cout << "\nIR-Drop statistics:\n\n";
@@ -119,13 +532,41 @@ int main(int args, const char* argv[])
             std::cout << "Mean -- Min: " << sumOfFakeIRDrops[1] / config.numOfFakes << "\n";
             std::cout << "Mean -- Mean: " << sumOfFakeIRDrops[2] / config.numOfFakes << "\n";
             std::cout << "Mean -- MeanDiff: " << sumOfPercentageDifferences / config.numOfFakes * 100.0 << "\n";
+            std::cout << "Mean -- Solves per fake: " << static_cast<Value>(sumOfSolves) / config.numOfFakes << "\n";
+
+            if (config.mode == 3 && config.isVerified)
+                std::cout << "Max -- Verification error: " << maxVerificationError << "\n";
 
             if (sumTimeOfGeneration != 0) {
                 std::cout << "\nTotal time of generation: " << sumTimeOfGeneration << " ms\n";
                 std::cout << "Average time of generation: " << sumTimeOfGeneration / config.numOfFakes << " ms\n";
+                std::cout << "Wall time of generation: " << wallTimeOfGeneration << " ms\n";
             }
+
+            uint64_t sumTimeOfWriting = outputPipeline.getWritingDuration();
+            uint64_t sumTimeOfBlocking = outputPipeline.getBlockedDuration();
+
+            std::cout << "\nOutput statistics:\n\n";
+            std::cout << std::setprecision(2);
+            std::cout << "Total time of solving: " << sumTimeOfSolving / 1000 << " ms\n";
+            std::cout << "Total time of snapshots: " << sumTimeOfSnapshots / 1000 << " ms\n";
+            std::cout << "Total time of writing: " << sumTimeOfWriting / 1000 << " ms\n";
+            std::cout << "Total time of rasterizing: " << outputPipeline.getRasterizingDuration() / 1000 << " ms\n";
+            std::cout << "Time of generation waiting for output: " << sumTimeOfBlocking / 1000 << " ms\n";
+            std::cout << "Estimated time of writing hidden behind generation: "
+                      << (sumTimeOfWriting > sumTimeOfBlocking ? sumTimeOfWriting - sumTimeOfBlocking : 0) / 1000 << " ms\n";
+            std::cout << "Speed of writing: "
+                      << static_cast<uint64_t>(outputPipeline.getTotalLines() * 1e6 / std::max<uint64_t>(sumTimeOfWriting, 1))
+                      << " lines/s\n";
+            std::cout << "Written data: " << outputPipeline.getTotalSize() / (1024.0 * 1024.0) << " MB\n";
+            std::cout << "Speed of writing: "
+                      << outputPipeline.getTotalSize() / (1024.0 * 1024.0) / std::max<uint64_t>(sumTimeOfWriting, 1) * 1e6
+                      << " MB/s\n";
+            std::cout << "Peak memory of snapshots: " << outputPipeline.getPeakMemorySize() / (1024.0 * 1024.0) << " MB\n";
         } catch (std::invalid_argument& e) {
             std::cerr << "\nArgument error: " << e.what() << "\n";
+        } catch (std::exception& e) {
+            std::cerr << "\nGeneration error: " << e.what() << "\n";
         }
 
         std::cout
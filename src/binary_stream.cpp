@@ -0,0 +1,57 @@
+// Project Libs
+#include "../include/binary_stream.h"
+
+BinaryWriter::BinaryWriter(const std::string& t_fileName)
+    : m_file(t_fileName, std::ios::binary | std::ios::trunc) {};
+
+bool BinaryWriter::isGood() const
+{
+    return m_file.is_open() && m_file.good();
+}
+
+uint64_t BinaryWriter::size() const
+{
+    return m_size;
+}
+
+void BinaryWriter::writeString(const std::string_view& t_string)
+{
+    write<uint64_t>(t_string.size());
+    m_file.write(t_string.data(), t_string.size());
+    m_size += t_string.size();
+}
+
+bool BinaryWriter::close()
+{
+    m_file.flush();
+    bool isWritten = isGood();
+    m_file.close();
+
+    return isWritten && !m_file.fail();
+}
+
+BinaryReader::BinaryReader(const std::string_view& t_buffer)
+    : m_buffer(t_buffer) {};
+
+std::string_view BinaryReader::readString()
+{
+    uint64_t size = read<uint64_t>();
+
+    return std::string_view(take(size), size);
+}
+
+bool BinaryReader::isEnd() const
+{
+    return m_position == m_buffer.size();
+}
+
+const char* BinaryReader::take(const uint64_t& t_size)
+{
+    if (t_size > m_buffer.size() - m_position)
+        throw std::runtime_error("Unexpected end of binary data");
+
+    const char* data = m_buffer.data() + m_position;
+    m_position += t_size;
+
+    return data;
+}
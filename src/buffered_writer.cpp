@@ -0,0 +1,115 @@
+// STL Libs
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+// Project Libs
+#include "../include/buffered_writer.h"
+
+// Max number of characters of one formatted number, fixed format of the largest double takes 309 digits
+constexpr static uint64_t MAX_NUMBER_SIZE = 512;
+
+BufferedWriter::BufferedWriter(const uint64_t& t_capacity)
+    : m_buffer(std::max<uint64_t>(t_capacity, MAX_NUMBER_SIZE)) {};
+
+BufferedWriter::~BufferedWriter()
+{
+    close();
+}
+
+bool BufferedWriter::open(const std::string& t_fileName)
+{
+    close();
+    m_file.open(t_fileName);
+    m_totalLines = 0;
+    m_fileSize = 0;
+
+    return m_file.is_open();
+}
+
+uint64_t BufferedWriter::close()
+{
+    if (m_file.is_open()) {
+        flush();
+        m_file.close();
+    }
+
+    m_size = 0;
+
+    return m_totalLines;
+}
+
+uint64_t BufferedWriter::fileSize() const
+{
+    return m_fileSize + m_size;
+}
+
+void BufferedWriter::write(const std::string_view& t_string)
+{
+    if (t_string.size() > m_buffer.size()) {
+        flush();
+        m_file.write(t_string.data(), t_string.size());
+        m_fileSize += t_string.size();
+    } else {
+        reserve(t_string.size());
+        std::memcpy(m_buffer.data() + m_size, t_string.data(), t_string.size());
+        m_size += t_string.size();
+    }
+
+    for (char character : t_string)
+        m_totalLines += character == '\n';
+}
+
+void BufferedWriter::write(const char& t_character)
+{
+    reserve(1);
+    m_buffer[m_size++] = t_character;
+    m_totalLines += t_character == '\n';
+}
+
+void BufferedWriter::writeUnsigned(const uint64_t& t_value)
+{
+    reserve(MAX_NUMBER_SIZE);
+    m_size = std::to_chars(m_buffer.data() + m_size, m_buffer.data() + m_buffer.size(), t_value).ptr - m_buffer.data();
+}
+
+void BufferedWriter::writeFixed(const Value& t_value, const int& t_precision)
+{
+    reserve(MAX_NUMBER_SIZE);
+    m_size = std::to_chars(m_buffer.data() + m_size, m_buffer.data() + m_buffer.size(), t_value,
+                 std::chars_format::fixed, t_precision)
+                 .ptr
+        - m_buffer.data();
+}
+
+void BufferedWriter::writeScientific(const Value& t_value, const int& t_precision)
+{
+    reserve(MAX_NUMBER_SIZE);
+    m_size = std::to_chars(m_buffer.data() + m_size, m_buffer.data() + m_buffer.size(), t_value,
+                 std::chars_format::scientific, t_precision)
+                 .ptr
+        - m_buffer.data();
+}
+
+void BufferedWriter::writeNodeName(const NodeCoords& t_nodeCoords)
+{
+    write(std::string_view("n1_m"));
+    writeUnsigned(t_nodeCoords[0]);
+    write('_');
+    writeUnsigned(t_nodeCoords[1]);
+    write('_');
+    writeUnsigned(t_nodeCoords[2]);
+}
+
+void BufferedWriter::reserve(const uint64_t& t_size)
+{
+    if (m_size + t_size > m_buffer.size())
+        flush();
+}
+
+void BufferedWriter::flush()
+{
+    m_file.write(m_buffer.data(), m_size);
+    m_fileSize += m_size;
+    m_size = 0;
+}
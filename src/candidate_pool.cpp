@@ -0,0 +1,85 @@
+// STL Libs
+#include <stdexcept>
+
+// Project Libs
+#include "../include/candidate_pool.h"
+
+void CandidatePool::reset(const uint64_t& t_capacity)
+{
+    m_indexes.clear();
+    m_erased.clear();
+    m_positions.assign(t_capacity, NO_POSITION);
+}
+
+uint64_t CandidatePool::size() const
+{
+    return m_indexes.size();
+}
+
+bool CandidatePool::contains(const uint64_t& t_index) const
+{
+    return t_index < m_positions.size() && m_positions[t_index] != NO_POSITION;
+}
+
+void CandidatePool::insert(const uint64_t& t_index)
+{
+    if (t_index >= m_positions.size())
+        m_positions.resize(t_index + 1, NO_POSITION);
+
+    if (m_positions[t_index] != NO_POSITION)
+        return;
+
+    m_positions[t_index] = m_indexes.size();
+    m_indexes.push_back(t_index);
+}
+
+void CandidatePool::erase(const uint64_t& t_index)
+{
+    if (!contains(t_index))
+        return;
+
+    uint64_t position = m_positions[t_index];
+    uint64_t lastIndex = m_indexes.back();
+
+    m_indexes[position] = lastIndex;
+    m_positions[lastIndex] = position;
+    m_indexes.pop_back();
+    m_positions[t_index] = NO_POSITION;
+    m_erased.push_back({ t_index, position });
+}
+
+uint64_t CandidatePool::mark() const
+{
+    return m_erased.size();
+}
+
+void CandidatePool::rollback(const uint64_t& t_mark)
+{
+    if (t_mark > m_erased.size())
+        throw std::runtime_error("Mark of the candidate pool is not valid");
+
+    while (m_erased.size() > t_mark) {
+        auto [index, position] = m_erased.back();
+        m_erased.pop_back();
+
+        // Inverse of erase: the index that took the position goes back to the end
+        if (position < m_indexes.size()) {
+            uint64_t movedIndex = m_indexes[position];
+
+            m_positions[movedIndex] = m_indexes.size();
+            m_indexes.push_back(movedIndex);
+            m_indexes[position] = index;
+        } else {
+            m_indexes.push_back(index);
+        }
+
+        m_positions[index] = position;
+    }
+}
+
+uint64_t CandidatePool::pick(std::mt19937& t_generator) const
+{
+    std::uniform_int_distribution<std::mt19937::result_type> distrPick(0, m_indexes.size() - 1);
+
+    return m_indexes[distrPick(t_generator)];
+}
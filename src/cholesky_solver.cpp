@@ -0,0 +1,257 @@
+// STL Libs
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+// Project Libs
+#include "../include/cholesky_solver.h"
+
+CholeskySolver::CholeskySolver(const ConductanceMatrix& t_matrix)
+{
+    orderMinimumDegree(t_matrix);
+    factor(t_matrix);
+}
+
+uint64_t CholeskySolver::factorSize() const
+{
+    return m_factorValues.size();
+}
+
+void CholeskySolver::orderMinimumDegree(const ConductanceMatrix& t_matrix)
+{
+    const uint64_t rowsSize = t_matrix.size();
+    std::vector<std::vector<uint64_t>> adjacency(rowsSize);
+    std::vector<uint64_t> marker(rowsSize, NO_ROW);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        marker[row] = row;
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k) {
+            uint64_t column = t_matrix.columnIndices[k];
+
+            if (marker[column] != row) {
+                marker[column] = row;
+                adjacency[row].push_back(column);
+            }
+        }
+    }
+
+    using DegreeEntry = std::pair<uint64_t, uint64_t>;
+    std::priority_queue<DegreeEntry, std::vector<DegreeEntry>, std::greater<DegreeEntry>> degrees {};
+    std::vector<bool> isEliminated(rowsSize, false);
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        degrees.emplace(adjacency[row].size(), row);
+
+    std::fill(marker.begin(), marker.end(), NO_ROW);
+    m_permutation.clear();
+    m_permutation.reserve(rowsSize);
+
+    // Eliminates the node with the smallest degree and connects its neighbors into a clique
+    while (!degrees.empty()) {
+        auto [degree, row] = degrees.top();
+        degrees.pop();
+
+        if (isEliminated[row] || adjacency[row].size() != degree)
+            continue;
+
+        isEliminated[row] = true;
+        m_permutation.push_back(row);
+
+        const auto& neighbors = adjacency[row];
+
+        for (uint64_t neighbor : neighbors) {
+            auto& neighborAdjacency = adjacency[neighbor];
+            uint64_t fill {};
+
+            for (uint64_t i {}; i < neighborAdjacency.size(); ++i) {
+                if (neighborAdjacency[i] != row) {
+                    marker[neighborAdjacency[i]] = neighbor;
+                    neighborAdjacency[fill++] = neighborAdjacency[i];
+                }
+            }
+
+            neighborAdjacency.resize(fill);
+
+            for (uint64_t other : neighbors) {
+                if (other != neighbor && marker[other] != neighbor)
+                    neighborAdjacency.push_back(other);
+            }
+
+            degrees.emplace(neighborAdjacency.size(), neighbor);
+        }
+
+        adjacency[row].clear();
+        adjacency[row].shrink_to_fit();
+    }
+
+    m_inversePermutation.resize(rowsSize);
+
+    for (uint64_t k {}; k < rowsSize; ++k)
+        m_inversePermutation[m_permutation[k]] = k;
+}
+
+void CholeskySolver::factor(const ConductanceMatrix& t_matrix)
+{
+    const uint64_t rowsSize = t_matrix.size();
+
+    // Upper triangle of the permuted matrix by columns, diagonal is stored separately
+    std::vector<uint64_t> upperOffsets(rowsSize + 1);
+    std::vector<uint64_t> upperRows {};
+    std::vector<Value> upperValues {};
+
+    upperRows.reserve(t_matrix.columnIndices.size() / 2);
+    upperValues.reserve(t_matrix.columnIndices.size() / 2);
+
+    for (uint64_t column {}; column < rowsSize; ++column) {
+        uint64_t row = m_permutation[column];
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k) {
+            uint64_t permutedRow = m_inversePermutation[t_matrix.columnIndices[k]];
+
+            if (permutedRow < column) {
+                upperRows.push_back(permutedRow);
+                upperValues.push_back(-t_matrix.conductances[k]);
+            }
+        }
+
+        upperOffsets[column + 1] = upperRows.size();
+    }
+
+    // Elimination tree
+    std::vector<uint64_t> parent(rowsSize, NO_ROW);
+    std::vector<uint64_t> ancestor(rowsSize, NO_ROW);
+
+    for (uint64_t column {}; column < rowsSize; ++column) {
+        for (uint64_t k = upperOffsets[column]; k < upperOffsets[column + 1]; ++k) {
+            for (uint64_t row = upperRows[k]; row != NO_ROW && row < column;) {
+                uint64_t nextRow = ancestor[row];
+                ancestor[row] = column;
+
+                if (nextRow == NO_ROW)
+                    parent[row] = column;
+
+                row = nextRow;
+            }
+        }
+    }
+
+    // Pattern of row k of the factor is the set of tree paths from upper entries of column k to k
+    std::vector<uint64_t> stack(rowsSize);
+    std::vector<uint64_t> marker(rowsSize, NO_ROW);
+
+    auto reach = [&](uint64_t column) -> uint64_t {
+        uint64_t top = rowsSize;
+        marker[column] = column;
+
+        for (uint64_t k = upperOffsets[column]; k < upperOffsets[column + 1]; ++k) {
+            uint64_t length {};
+
+            for (uint64_t row = upperRows[k]; marker[row] != column; row = parent[row]) {
+                stack[length++] = row;
+                marker[row] = column;
+            }
+
+            while (length > 0)
+                stack[--top] = stack[--length];
+        }
+
+        return top;
+    };
+
+    // Symbolic factorization
+    std::vector<uint64_t> columnCounts(rowsSize, 1);
+
+    for (uint64_t column {}; column < rowsSize; ++column) {
+        for (uint64_t top = reach(column); top < rowsSize; ++top)
+            ++columnCounts[stack[top]];
+    }
+
+    m_factorOffsets.assign(rowsSize + 1, 0);
+
+    for (uint64_t column {}; column < rowsSize; ++column)
+        m_factorOffsets[column + 1] = m_factorOffsets[column] + columnCounts[column];
+
+    m_factorRows.resize(m_factorOffsets.back());
+    m_factorValues.resize(m_factorOffsets.back());
+
+    // Up-looking numeric factorization, computes one row of the factor per step
+    std::vector<uint64_t> nextFree(m_factorOffsets.begin(), m_factorOffsets.end() - 1);
+    std::vector<Value> values(rowsSize);
+    std::fill(marker.begin(), marker.end(), NO_ROW);
+
+    for (uint64_t column {}; column < rowsSize; ++column) {
+        uint64_t top = reach(column);
+        Value pivot = t_matrix.diagonal[m_permutation[column]];
+
+        for (uint64_t k = upperOffsets[column]; k < upperOffsets[column + 1]; ++k)
+            values[upperRows[k]] += upperValues[k];
+
+        for (; top < rowsSize; ++top) {
+            uint64_t row = stack[top];
+            Value factorValue = values[row] / m_factorValues[m_factorOffsets[row]];
+            values[row] = 0;
+
+            for (uint64_t k = m_factorOffsets[row] + 1; k < nextFree[row]; ++k)
+                values[m_factorRows[k]] -= m_factorValues[k] * factorValue;
+
+            pivot -= factorValue * factorValue;
+
+            m_factorRows[nextFree[row]] = column;
+            m_factorValues[nextFree[row]++] = factorValue;
+        }
+
+        if (pivot <= 0)
+            throw std::runtime_error("Conductance matrix is not positive definite, check for floating nodes.");
+
+        m_factorRows[nextFree[column]] = column;
+        m_factorValues[nextFree[column]++] = std::sqrt(pivot);
+    }
+}
+
+uint64_t CholeskySolver::solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, Value& t_residual) const
+{
+    const uint64_t rowsSize = t_matrix.size();
+    std::vector<Value> workValues(rowsSize);
+
+    for (uint64_t k {}; k < rowsSize; ++k) {
+        uint64_t row = m_permutation[k];
+        workValues[k] = t_matrix.fixedCurrents[row] - t_state.currents[row];
+    }
+
+    // Forward substitution: L * y = P * b
+    for (uint64_t column {}; column < rowsSize; ++column) {
+        workValues[column] /= m_factorValues[m_factorOffsets[column]];
+
+        for (uint64_t k = m_factorOffsets[column] + 1; k < m_factorOffsets[column + 1]; ++k)
+            workValues[m_factorRows[k]] -= m_factorValues[k] * workValues[column];
+    }
+
+    // Backward substitution: L^T * x = y
+    for (uint64_t column = rowsSize; column-- > 0;) {
+        for (uint64_t k = m_factorOffsets[column] + 1; k < m_factorOffsets[column + 1]; ++k)
+            workValues[column] -= m_factorValues[k] * workValues[m_factorRows[k]];
+
+        workValues[column] /= m_factorValues[m_factorOffsets[column]];
+    }
+
+    for (uint64_t k {}; k < rowsSize; ++k)
+        t_state.values[m_permutation[k]] = workValues[k];
+
+    // Relative residual norm for reporting, work values are reused as residual
+    Value residualNorm {};
+    Value rightHandSideNorm {};
+    t_matrix.residual(t_state, workValues);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        Value rightHandSide = t_matrix.fixedCurrents[row] - t_state.currents[row];
+        residualNorm += workValues[row] * workValues[row];
+        rightHandSideNorm += rightHandSide * rightHandSide;
+    }
+
+    t_residual = rightHandSideNorm > 0 ? std::sqrt(residualNorm / rightHandSideNorm) : std::sqrt(residualNorm);
+
+    return 1;
+}
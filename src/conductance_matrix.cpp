@@ -0,0 +1,292 @@
+// STL Libs
+#include <algorithm>
+#include <cmath>
+
+// Project Libs
+#include "../include/conductance_matrix.h"
+#include "../include/vector_kernels.h"
+
+uint64_t ConductanceMatrix::size() const
+{
+    return rowNodes.size();
+}
+
+uint64_t ConductanceMatrix::stepGaussSeidel(ConductanceState& t_state, const Value& t_precision,
+    const uint64_t& t_rowBegin) const
+{
+    uint64_t totalRowsSolved {};
+    const uint64_t rowsSize = size();
+    auto& values = t_state.values;
+    const auto& currents = t_state.currents;
+
+    for (uint64_t row = t_rowBegin; row < rowsSize; ++row) {
+        Value sumOfNodes = fixedCurrents[row];
+
+        for (uint64_t k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k)
+            sumOfNodes += conductances[k] * values[columnIndices[k]];
+
+        Value previousValue = values[row];
+        values[row] = (sumOfNodes - currents[row]) * inverseDiagonal[row];
+
+        if (std::fabs(values[row] - previousValue) < t_precision)
+            ++totalRowsSolved;
+    }
+
+    return totalRowsSolved;
+}
+
+uint64_t ConductanceMatrix::stepMulticolorGaussSeidel(ConductanceState& t_state, const Value& t_precision,
+    ThreadPool& t_threadPool) const
+{
+    // Padded counters so threads do not share cache lines
+    constexpr uint64_t COUNTER_STRIDE = 8;
+    std::vector<uint64_t> threadRowsSolved(t_threadPool.size() * COUNTER_STRIDE);
+
+    for (uint64_t color {}; color + 1 < colorOffsets.size(); ++color) {
+        t_threadPool.parallelFor(sliceColorOffsets[color], sliceColorOffsets[color + 1],
+            [&](uint64_t t_begin, uint64_t t_end, uint64_t t_threadIndex) {
+                uint64_t totalRowsSolved = VectorKernels::relaxSlices(*this, t_state, t_begin, t_end, t_precision);
+
+                threadRowsSolved[t_threadIndex * COUNTER_STRIDE] += totalRowsSolved;
+            });
+    }
+
+    uint64_t totalRowsSolved {};
+
+    for (uint64_t i {}; i < threadRowsSolved.size(); i += COUNTER_STRIDE)
+        totalRowsSolved += threadRowsSolved[i];
+
+    return totalRowsSolved;
+}
+
+uint64_t ConductanceMatrix::relaxLocal(ConductanceState& t_state, const Value& t_precision,
+    const uint64_t& t_maxRelaxations) const
+{
+    const uint64_t rowsSize = size();
+    uint64_t totalRelaxations {};
+    auto& values = t_state.values;
+    auto& residuals = t_state.residuals;
+    auto& rowQueue = t_state.rowQueue;
+    auto& isRowQueued = t_state.isRowQueued;
+    const auto& currents = t_state.currents;
+
+    if (rowsSize == 0)
+        return totalRelaxations;
+
+    // Ring buffer of queued rows, every row is queued at most once
+    rowQueue.resize(rowsSize);
+    isRowQueued.resize(rowsSize, false);
+    uint64_t head {};
+    uint64_t queueSize {};
+
+    auto pushIfUnsolved = [&](uint64_t t_row) {
+        if (!isRowQueued[t_row] && std::fabs(residuals[t_row]) * inverseDiagonal[t_row] >= t_precision) {
+            isRowQueued[t_row] = true;
+            rowQueue[(head + queueSize++) % rowsSize] = t_row;
+        }
+    };
+
+    auto rowResidual = [&](uint64_t t_row) {
+        Value sumOfNodes = fixedCurrents[t_row] - currents[t_row] - diagonal[t_row] * values[t_row];
+
+        for (uint64_t k = rowOffsets[t_row]; k < rowOffsets[t_row + 1]; ++k)
+            sumOfNodes += conductances[k] * values[columnIndices[k]];
+
+        return sumOfNodes;
+    };
+
+    // Residuals of unchanged rows are kept from the previous solve, rows it left queued are relaxed first
+    if (!t_state.isSolved || residuals.size() != rowsSize) {
+        residuals.resize(rowsSize);
+        isRowQueued.assign(rowsSize, false);
+
+        for (uint64_t row {}; row < rowsSize; ++row) {
+            residuals[row] = rowResidual(row);
+            pushIfUnsolved(row);
+        }
+    } else {
+        queueSize = t_state.queuedRowsSize;
+
+        for (uint64_t row : t_state.changedRows) {
+            residuals[row] = rowResidual(row);
+            pushIfUnsolved(row);
+        }
+    }
+
+    while (queueSize > 0 && totalRelaxations < t_maxRelaxations) {
+        uint64_t row = rowQueue[head];
+        head = (head + 1) % rowsSize;
+        --queueSize;
+        isRowQueued[row] = false;
+
+        Value delta = residuals[row] * inverseDiagonal[row];
+        values[row] += delta;
+        residuals[row] = 0;
+        ++totalRelaxations;
+
+        for (uint64_t k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k) {
+            uint64_t neighbor = columnIndices[k];
+            residuals[neighbor] += conductances[k] * delta;
+            pushIfUnsolved(neighbor);
+        }
+    }
+
+    // Rows left by the max number of relaxations stay queued from the front of the buffer
+    if (queueSize > 0)
+        std::rotate(rowQueue.begin(), rowQueue.begin() + head, rowQueue.end());
+
+    t_state.queuedRowsSize = queueSize;
+
+    return totalRelaxations;
+}
+
+void ConductanceMatrix::buildColors()
+{
+    const uint64_t rowsSize = size();
+    std::vector<uint64_t> rowColors(rowsSize, NO_ROW);
+    std::vector<uint64_t> usedColors {};
+    uint64_t colorsSize {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        for (uint64_t k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k) {
+            uint64_t neighborColor = rowColors[columnIndices[k]];
+
+            if (neighborColor != NO_ROW)
+                usedColors[neighborColor] = row;
+        }
+
+        uint64_t color {};
+
+        while (color < colorsSize && usedColors[color] == row)
+            ++color;
+
+        if (color == colorsSize) {
+            usedColors.push_back(NO_ROW);
+            ++colorsSize;
+        }
+
+        rowColors[row] = color;
+    }
+
+    // Rows of every color keep ascending order for locality
+    colorOffsets.assign(colorsSize + 1, 0);
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        ++colorOffsets[rowColors[row] + 1];
+
+    for (uint64_t color {}; color < colorsSize; ++color)
+        colorOffsets[color + 1] += colorOffsets[color];
+
+    std::vector<uint64_t> colorFill(colorOffsets.begin(), colorOffsets.end() - 1);
+    colorRows.resize(rowsSize);
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        colorRows[colorFill[rowColors[row]]++] = row;
+}
+
+void ConductanceMatrix::buildSlices()
+{
+    sliceColorOffsets.assign(1, 0);
+    sliceRowOffsets.assign(1, 0);
+    sliceRows.clear();
+    sliceEntryOffsets.assign(1, 0);
+    sliceColumns.clear();
+    sliceConductances.clear();
+
+    for (uint64_t color {}; color + 1 < colorOffsets.size(); ++color) {
+        for (uint64_t begin = colorOffsets[color]; begin < colorOffsets[color + 1]; begin += SLICE_ROWS) {
+            uint64_t end = std::min(begin + SLICE_ROWS, colorOffsets[color + 1]);
+            uint64_t width {};
+
+            for (uint64_t i = begin; i < end; ++i)
+                width = std::max(width, rowOffsets[colorRows[i] + 1] - rowOffsets[colorRows[i]]);
+
+            for (uint64_t lane {}; lane < SLICE_ROWS; ++lane)
+                sliceRows.push_back(colorRows[begin + lane < end ? begin + lane : begin]);
+
+            for (uint64_t entry {}; entry < width; ++entry) {
+                for (uint64_t lane {}; lane < SLICE_ROWS; ++lane) {
+                    uint64_t row = sliceRows[sliceRows.size() - SLICE_ROWS + lane];
+                    uint64_t k = rowOffsets[row] + entry;
+                    bool isEntry = begin + lane < end && k < rowOffsets[row + 1];
+
+                    sliceColumns.push_back(isEntry ? columnIndices[k] : row);
+                    sliceConductances.push_back(isEntry ? conductances[k] : 0);
+                }
+            }
+
+            sliceRowOffsets.push_back(end);
+            sliceEntryOffsets.push_back(sliceColumns.size());
+        }
+
+        sliceColorOffsets.push_back(sliceRowOffsets.size() - 1);
+    }
+}
+
+std::array<Value, 2> ConductanceMatrix::calculateLocality(const uint64_t& t_windowRows) const
+{
+    const uint64_t entriesSize = columnIndices.size();
+    Value sumOfDistances {};
+    uint64_t totalFarEntries {};
+
+    for (uint64_t row {}; row < size(); ++row) {
+        for (uint64_t k = rowOffsets[row]; k < rowOffsets[row + 1]; ++k) {
+            uint64_t distance = row > columnIndices[k] ? row - columnIndices[k] : columnIndices[k] - row;
+
+            sumOfDistances += distance;
+
+            if (distance > t_windowRows)
+                ++totalFarEntries;
+        }
+    }
+
+    if (entriesSize == 0)
+        return { 0, 0 };
+
+    return { sumOfDistances / entriesSize, static_cast<Value>(totalFarEntries) / entriesSize };
+}
+
+void ConductanceMatrix::multiply(const std::vector<Value>& t_vector, std::vector<Value>& t_result) const
+{
+    const uint64_t rowsSize = size();
+    t_result.resize(rowsSize);
+
+    VectorKernels::multiply(*this, t_vector.data(), t_result.data());
+}
+
+void ConductanceMatrix::residual(const ConductanceState& t_state, std::vector<Value>& t_residual) const
+{
+    multiply(t_state.values, t_residual);
+
+    for (uint64_t row {}; row < size(); ++row)
+        t_residual[row] = fixedCurrents[row] - t_state.currents[row] - t_residual[row];
+}
+
+ConductanceState ConductanceMatrix::createState(const Value& t_value) const
+{
+    ConductanceState state {};
+    state.values.resize(size(), t_value);
+    state.currents.resize(size());
+
+    return state;
+}
+
+void ConductanceMatrix::clear()
+{
+    diagonal.clear();
+    inverseDiagonal.clear();
+    fixedCurrents.clear();
+    rowOffsets.clear();
+    columnIndices.clear();
+    conductances.clear();
+    rowNodes.clear();
+    nodeRows.clear();
+    colorOffsets.clear();
+    colorRows.clear();
+    sliceColorOffsets.clear();
+    sliceRowOffsets.clear();
+    sliceRows.clear();
+    sliceEntryOffsets.clear();
+    sliceColumns.clear();
+    sliceConductances.clear();
+}
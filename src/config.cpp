@@ -19,16 +19,75 @@ Config::Config(const int& args, const char* argv[])
             irDropDiff = std::stod(argv[i + 1]);
         } else if (std::string(argv[i]) == "--numOfFakes" || std::string(argv[i]) == "-nof") {
             numOfFakes = std::stol(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--solver" || std::string(argv[i]) == "-sv") {
+            solver = argv[i + 1];
+        } else if (std::string(argv[i]) == "--preconditioner" || std::string(argv[i]) == "-pc") {
+            preconditioner = argv[i + 1];
+        } else if (std::string(argv[i]) == "--threads" || std::string(argv[i]) == "-t") {
+            threads = std::stoull(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--jobs" || std::string(argv[i]) == "-j") {
+            jobs = std::stoull(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--seed") {
+            seed = std::stoull(argv[i + 1]);
+            isSeed = true;
+        } else if (std::string(argv[i]) == "--cache" || std::string(argv[i]) == "-c") {
+            isCached = std::stol(argv[i + 1]) != 0;
+        } else if (std::string(argv[i]) == "--writers" || std::string(argv[i]) == "-w") {
+            writers = std::stol(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--writeQueue" || std::string(argv[i]) == "-wq") {
+            writeQueue = std::stol(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--delta" || std::string(argv[i]) == "-dl") {
+            isDelta = std::stol(argv[i + 1]) != 0;
+        } else if (std::string(argv[i]) == "--archive" || std::string(argv[i]) == "-a") {
+            archive = std::stol(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--extract" || std::string(argv[i]) == "-x") {
+            extractIndex = std::stoull(argv[i + 1]);
+            isExtract = true;
+        } else if (std::string(argv[i]) == "--mapBin" || std::string(argv[i]) == "-mb") {
+            mapBin = std::stoul(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--verify" || std::string(argv[i]) == "-vf") {
+            isVerified = std::stol(argv[i + 1]) != 0;
+        } else if (std::string(argv[i]) == "--tolerance" || std::string(argv[i]) == "-tol") {
+            tolerance = std::stod(argv[i + 1]);
+        } else if (std::string(argv[i]) == "--guided" || std::string(argv[i]) == "-g") {
+            isGuided = std::stol(argv[i + 1]) != 0;
+        } else if (std::string(argv[i]) == "--ordering" || std::string(argv[i]) == "-or") {
+            ordering = argv[i + 1];
+        } else if (std::string(argv[i]) == "--simd" || std::string(argv[i]) == "-sd") {
+            simd = argv[i + 1];
+        } else if (std::string(argv[i]) == "--workingPrecision" || std::string(argv[i]) == "-wp") {
+            workingPrecision = argv[i + 1];
+        } else if (std::string(argv[i]) == "--benchmark" || std::string(argv[i]) == "-bm") {
+            isBenchmark = std::stol(argv[i + 1]) != 0;
         } else if (std::string(argv[i]) == "--help" || std::string(argv[i]) == "-h") {
             std::cout << "Usage: \n"
                       << "--help [-h] - Show help information.\n\n"
                       << "--source [-s] - Path to source .sp file. Default - ./netlist.sp\n\n"
                       << "--destination [-d] - Path to destination folder where will be stored all generated fakes. Default - ./\n\n"
-                      << "--mode [-m] - Mode of generator: '1' - Moves current sources from origin nodes to random ones. '2' - Add new current sources to random nodes. '3' - Increase volume of current sources. Default - 1\n\n"
+                      << "--mode [-m] - Mode of generator: '1' - Moves current sources from origin nodes to random ones. '2' - Add new current sources to random nodes. '3' - Increase volume of current sources, the ir-drop is scaled by the same factor without solving. Default - 1\n\n"
                       << "--irDropPrecision [-irp] - Precision of ir-drop calculation. Default - 1e-8\n\n"
                       << "--maxIterations [-mi] - Maximum number of iterations of ir-drop calculation. Default - 100000\n\n"
                       << "--irDropDiff [-ird] - Expected max difference of fake's pdn's ir-drop values from original pdn. Default - 0.75\n\n"
-                      << "--numOfFakes [-nof] - Numb of fake pdn to generate. Default - 10\n\n" << std::flush;
+                      << "--numOfFakes [-nof] - Numb of fake pdn to generate. Default - 10\n\n"
+                      << "--solver [-sv] - Solver of ir-drop: 'gs' - Gauss-Seidel sweeps. 'pcg' - Preconditioned conjugate gradient, --irDropPrecision is the relative residual norm. 'cholesky' - Sparse Cholesky factorization computed once and reused for every solve. 'amg' - Algebraic multigrid v-cycles. 'local' - Relaxation of nodes around changed current sources only. 'stencil' - Red-black gauss-seidel over regular lattices of layers stored as dense arrays with vector kernels, other nodes by gauss-seidel sweeps. Default - gs\n\n"
+                      << "--preconditioner [-pc] - Preconditioner of 'pcg' solver: 'jacobi' - Diagonal. 'ic' - Incomplete Cholesky. 'amg' - Algebraic multigrid v-cycle. Default - jacobi\n\n"
+                      << "--threads [-t] - Number of threads of 'gs' solver, more than one relaxes nodes color by color in parallel. With --jobs above zero only the original pdn is solved on the threads, jobs sweep sequentially. Default - 1\n\n"
+                      << "--jobs [-j] - Number of fakes generated in parallel, every fake is generated independently from the original pdn and solved by the sequential sweep, --threads does not apply to jobs. '0' - Fakes are generated one by one, every fake continues the previous one. Default - 0\n\n"
+                      << "--seed - Seed of random placement of current sources, fakes with the same seed and index are equal for any number of jobs. Default - random\n\n"
+                      << "--cache [-c] - Binary cache of the parsed source and its ir-drop solution, stored next to the source as .cache file. '1' - Read the cache if it matches the source, write it otherwise. '0' - Always parse the source. Default - 1\n\n"
+                      << "--writers [-w] - Number of threads writing fakes to files while the next fakes are generated. '0' - Fakes are written by the generating thread. Default - 1\n\n"
+                      << "--writeQueue [-wq] - Max number of generated fakes waiting for writers, generation waits while the queue is full. Default - 2\n\n"
+                      << "--delta [-dl] - '1' - Resistors and voltage sources are written once to netlist-base.sp in the destination folder, netlist of every fake includes it and holds only its current sources. '0' - Every fake holds the whole netlist. Default - 0\n\n"
+                      << "--archive [-a] - Writes all fakes to one dataset-mode-[mode].pdna file with an index of fakes instead of a folder per fake, base netlist is written as with --delta. '32' - ir-drop is stored as float32. '64' - ir-drop is stored as float64. '0' - No archive. Default - 0\n\n"
+                      << "--extract [-x] - Index of the fake to extract from the archive given by --source to the --destination folder, nothing is generated.\n\n"
+                      << "--mapBin [-mb] - Size of the bin of rasterized maps in node coordinates. Every fake gets float32 .npy maps of max ir-drop and total current per bin of every metal layer, maps of total resistance per bin are written once to the destination folder. '0' - No maps. Default - 0\n\n"
+                      << "--verify [-vf] - '1' - Fakes of mode 3 are solved after scaling and the max difference from the scaled ir-drop is printed. '0' - No solves in mode 3. Default - 0\n\n"
+                      << "--tolerance [-tol] - Relative tolerance of the ir-drop difference of modes 1 and 2, the fraction of changed current sources is searched until the difference is within the tolerance of its target. Default - 0.1\n\n"
+                      << "--guided [-g] - '1' - Mode 2 places current sources until the ir-drop difference predicted by adjoint sensitivities of the nodes reaches its target, the search runs on the predicted difference instead of the fraction of current sources. '0' - Fraction of current sources is searched. Default - 0\n\n"
+                      << "--ordering [-or] - Order of rows of the conductance matrix, neighbors close in memory make sweeps of solvers faster. 'netlist' - Order of nodes in the netlist. 'morton' - Morton curve over coordinates of nodes. 'hilbert' - Hilbert curve over coordinates of nodes. 'rcm' - Reverse Cuthill-McKee over resistors. The output keeps the order of the netlist. Default - netlist\n\n"
+                      << "--simd [-sd] - Vector instructions of kernels of solvers and comparisons of fakes. 'auto' - Widest instructions supported by the cpu. 'scalar' - No vector instructions. 'avx2' - AVX2 with FMA. 'avx512' - AVX-512. Default - auto\n\n"
+                      << "--benchmark [-bm] - '1' - Times of kernels with every supported --simd are measured on the source pdn and printed before generation. '0' - No measurement. Default - 0\n\n"
+                      << "--workingPrecision [-wp] - Precision of sweeps of 'gs' solver on one thread. 'double' - Sweeps in double. 'float' - Sweeps in float over a float copy of the matrix with 32-bit indices, the solution is refined in double until it meets --irDropPrecision. Default - double\n\n" << std::flush;
         };
     }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <sstream>
 
 // Project libs
+#include "../include/buffered_writer.h"
 #include "../include/current_source.h"
 
 CurrentSource::CurrentSource(const NodeCoords& t_firstNode, const Value& t_value, const Name& t_name)
@@ -19,6 +20,11 @@ void CurrentSource::setNewCoords(const NodeCoords& t_node)
     m_y = t_node[2];
 }
 
+NodeCoords CurrentSource::getCoordinates() const
+{
+    return NodeCoords({ m_layer, m_x, m_y });
+}
+
 std::string CurrentSource::toString()
 {
     std::stringstream withoutNameDescription;
@@ -29,7 +35,9 @@ std::string CurrentSource::toString()
     return withoutNameDescription.str();
 }
 
-void CurrentSource::fullyDisconnection()
+void CurrentSource::write(BufferedWriter& t_writer) const
 {
-    connectedNode = nullptr;
-};
\ No newline at end of file
+    t_writer.writeNodeName({ m_layer, m_x, m_y });
+    t_writer.write(std::string_view(" 0 "));
+    t_writer.writeFixed(value, 9);
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+// STL Libs
+#include <algorithm>
+#include <stdexcept>
+
+// Project Libs
+#include "../include/buffered_writer.h"
+#include "../include/dataset_archive.h"
+#include "../include/node.h"
+#include "../include/resistor.h"
+
+// First bytes of the archive file: "PDNARCHV"
+constexpr static uint64_t ARCHIVE_MAGIC = 0x56484352414e4450ULL;
+// Last bytes of the archive file, written with the index: "PDNINDEX"
+constexpr static uint64_t ARCHIVE_INDEX_MAGIC = 0x5845444e494e4450ULL;
+// Version of the archive layout
+constexpr static uint32_t ARCHIVE_VERSION = 1;
+// Size of the footer: offset of the index and its magic
+constexpr static uint64_t ARCHIVE_FOOTER_SIZE = 2 * sizeof(uint64_t);
+
+DatasetArchiveWriter::DatasetArchiveWriter(const std::string& t_fileName, const PDNTopology& t_topology,
+    const uint8_t& t_mode, const bool& t_isSinglePrecision)
+    : m_writer(t_fileName)
+    , m_isSinglePrecision(t_isSinglePrecision)
+{
+    if (!m_writer.isGood())
+        throw std::invalid_argument("Can not create archive: " + t_fileName);
+
+    std::vector<NodeCoords> nodeCoords {};
+    nodeCoords.reserve(t_topology.nodes->size());
+
+    for (uint64_t i {}; i < t_topology.nodes->size(); ++i)
+        nodeCoords.push_back(t_topology.nodes->getCoordinates(i));
+
+    m_writer.write<uint64_t>(ARCHIVE_MAGIC);
+    m_writer.write<uint32_t>(ARCHIVE_VERSION);
+    m_writer.write<uint8_t>(t_mode);
+    m_writer.write<uint8_t>(m_isSinglePrecision);
+    m_writer.write<Value>(t_topology.voltageSourceValue);
+    m_writer.writeArray(nodeCoords);
+}
+
+DatasetArchiveWriter::~DatasetArchiveWriter()
+{
+    close();
+}
+
+uint64_t DatasetArchiveWriter::append(const PDNSnapshot& t_snapshot)
+{
+    // Values are converted before taking the lock, only the file writes are serialized
+    std::vector<float> singleIRDrops {};
+    std::vector<Value> doubleIRDrops {};
+
+    for (const auto& value : t_snapshot.nodeValues) {
+        if (m_isSinglePrecision)
+            singleIRDrops.push_back(static_cast<float>(t_snapshot.topology->voltageSourceValue - value));
+        else
+            doubleIRDrops.push_back(t_snapshot.topology->voltageSourceValue - value);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ArchiveEntry entry { t_snapshot.fakeIndex, m_writer.size(), 0 };
+
+    m_writer.write<uint64_t>(t_snapshot.fakeIndex);
+    m_writer.write<uint64_t>(t_snapshot.currentSources.size());
+
+    for (const auto& currentSource : t_snapshot.currentSources) {
+        m_writer.write<NodeCoords>(currentSource.getCoordinates());
+        m_writer.write<Value>(currentSource.value);
+        m_writer.writeString(currentSource.name);
+    }
+
+    if (m_isSinglePrecision)
+        m_writer.writeArray(singleIRDrops);
+    else
+        m_writer.writeArray(doubleIRDrops);
+
+    entry.size = m_writer.size() - entry.offset;
+    m_index.push_back(entry);
+
+    return entry.size;
+}
+
+bool DatasetArchiveWriter::close()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_isClosed)
+        return true;
+
+    m_isClosed = true;
+
+    std::sort(m_index.begin(), m_index.end(),
+        [](const ArchiveEntry& t_first, const ArchiveEntry& t_second) { return t_first.fakeIndex < t_second.fakeIndex; });
+
+    uint64_t indexOffset = m_writer.size();
+    m_writer.writeArray(m_index);
+    m_writer.write<uint64_t>(indexOffset);
+    m_writer.write<uint64_t>(ARCHIVE_INDEX_MAGIC);
+
+    return m_writer.close();
+}
+
+DatasetArchiveReader::DatasetArchiveReader(const std::string& t_fileName)
+    : m_file(t_fileName)
+{
+    if (!m_file.isOpen())
+        throw std::invalid_argument("Can not open archive: " + t_fileName);
+
+    const std::string_view view = m_file.view();
+
+    if (view.size() < ARCHIVE_FOOTER_SIZE)
+        throw std::runtime_error("Archive is broken: " + t_fileName);
+
+    BinaryReader headerReader(view);
+
+    if (headerReader.read<uint64_t>() != ARCHIVE_MAGIC || headerReader.read<uint32_t>() != ARCHIVE_VERSION)
+        throw std::runtime_error("Unknown archive format: " + t_fileName);
+
+    m_mode = headerReader.read<uint8_t>();
+    m_isSinglePrecision = headerReader.read<uint8_t>() != 0;
+    m_topology = std::make_shared<PDNTopology>();
+    m_topology->voltageSourceValue = headerReader.read<Value>();
+
+    auto nodes = std::make_shared<NodeStore>();
+    auto allNodeCoords = headerReader.readArray<NodeCoords>();
+    nodes->reserve(allNodeCoords.size());
+
+    for (const auto& nodeCoords : allNodeCoords)
+        nodes->add(nodeCoords);
+
+    m_topology->nodes = nodes;
+    m_topology->resistors = std::make_shared<ResistorStore>();
+
+    BinaryReader footerReader(view.substr(view.size() - ARCHIVE_FOOTER_SIZE));
+    uint64_t indexOffset = footerReader.read<uint64_t>();
+
+    if (footerReader.read<uint64_t>() != ARCHIVE_INDEX_MAGIC || indexOffset > view.size() - ARCHIVE_FOOTER_SIZE)
+        throw std::runtime_error("Archive has no index, it is not closed: " + t_fileName);
+
+    BinaryReader indexReader(view.substr(indexOffset, view.size() - ARCHIVE_FOOTER_SIZE - indexOffset));
+    m_index = indexReader.readArray<ArchiveEntry>();
+
+    for (const auto& entry : m_index) {
+        if (entry.offset > indexOffset || entry.size > indexOffset - entry.offset)
+            throw std::runtime_error("Archive index is broken: " + t_fileName);
+    }
+}
+
+uint64_t DatasetArchiveReader::size() const
+{
+    return m_index.size();
+}
+
+uint8_t DatasetArchiveReader::getMode() const
+{
+    return m_mode;
+}
+
+std::vector<NodeCoords> DatasetArchiveReader::getNodeCoords() const
+{
+    std::vector<NodeCoords> nodeCoords {};
+    nodeCoords.reserve(m_topology->nodes->size());
+
+    for (uint64_t i {}; i < m_topology->nodes->size(); ++i)
+        nodeCoords.push_back(m_topology->nodes->getCoordinates(i));
+
+    return nodeCoords;
+}
+
+ArchiveFake DatasetArchiveReader::read(const uint64_t& t_fakeIndex) const
+{
+    auto entry = std::lower_bound(m_index.begin(), m_index.end(), t_fakeIndex,
+        [](const ArchiveEntry& t_entry, const uint64_t& t_index) { return t_entry.fakeIndex < t_index; });
+
+    if (entry == m_index.end() || entry->fakeIndex != t_fakeIndex)
+        throw std::invalid_argument("Archive has no fake " + std::to_string(t_fakeIndex));
+
+    BinaryReader reader(m_file.view().substr(entry->offset, entry->size));
+    ArchiveFake fake {};
+
+    fake.fakeIndex = reader.read<uint64_t>();
+    fake.currentSources.resize(reader.read<uint64_t>());
+
+    for (auto& currentSource : fake.currentSources) {
+        auto nodeCoords = reader.read<NodeCoords>();
+        auto value = reader.read<Value>();
+        currentSource = CurrentSource(nodeCoords, value, Name(reader.readString()));
+    }
+
+    if (m_isSinglePrecision) {
+        auto irDrops = reader.readArray<float>();
+        fake.irDrops.assign(irDrops.begin(), irDrops.end());
+    } else {
+        fake.irDrops = reader.readArray<Value>();
+    }
+
+    if (fake.irDrops.size() != m_topology->nodes->size())
+        throw std::runtime_error("Archive record does not match its nodes");
+
+    return fake;
+}
+
+uint64_t DatasetArchiveReader::extract(const uint64_t& t_fakeIndex, const std::string& t_netlistFileName,
+    const std::string& t_irDropFileName, const std::string& t_baseNetlistInclude) const
+{
+    ArchiveFake fake = read(t_fakeIndex);
+    PDNSnapshot snapshot {};
+
+    snapshot.topology = m_topology;
+    snapshot.fakeIndex = fake.fakeIndex;
+    snapshot.currentSources = std::move(fake.currentSources);
+    snapshot.netlistFileName = t_netlistFileName;
+    snapshot.irDropFileName = t_irDropFileName;
+    snapshot.baseNetlistInclude = t_baseNetlistInclude;
+    snapshot.nodeValues.reserve(fake.irDrops.size());
+
+    for (const auto& irDrop : fake.irDrops)
+        snapshot.nodeValues.push_back(m_topology->voltageSourceValue - irDrop);
+
+    BufferedWriter writer {};
+
+    return snapshot.writeNetlist(writer) + snapshot.writeIRDrop(writer);
+}
@@ -0,0 +1,165 @@
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// STL Libs
+#include <array>
+#include <cstring>
+
+// Project Libs
+#include "../include/mapped_file.h"
+
+// Multipliers of the content hash
+constexpr static uint64_t HASH_PRIME_1 = 0x9e3779b185ebca87ULL;
+constexpr static uint64_t HASH_PRIME_2 = 0xc2b2ae3d27d4eb4fULL;
+
+/**
+ * @brief Mixes one word of the content into the lane of the hash
+ *
+ * @param t_lane lane of the hash
+ * @param t_word word of the content
+ * @return uint64_t new lane
+ */
+static inline uint64_t mix(uint64_t t_lane, const uint64_t& t_word)
+{
+    t_lane += t_word * HASH_PRIME_2;
+    t_lane = (t_lane << 31) | (t_lane >> 33);
+
+    return t_lane * HASH_PRIME_1;
+}
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& t_fileName)
+{
+    HANDLE file = CreateFileA(t_fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return;
+
+    m_file = file;
+    LARGE_INTEGER fileSize {};
+
+    if (!GetFileSizeEx(file, &fileSize))
+        return;
+
+    m_size = static_cast<uint64_t>(fileSize.QuadPart);
+    m_isOpen = true;
+
+    // Empty files can not be mapped
+    if (m_size == 0)
+        return;
+
+    m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (m_mapping)
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+
+    if (!m_data) {
+        m_size = 0;
+        m_isOpen = false;
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+        UnmapViewOfFile(m_data);
+
+    if (m_mapping)
+        CloseHandle(m_mapping);
+
+    if (m_file)
+        CloseHandle(m_file);
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& t_fileName)
+{
+    m_file = open(t_fileName.c_str(), O_RDONLY);
+
+    if (m_file < 0)
+        return;
+
+    struct stat fileStatus {};
+
+    if (fstat(m_file, &fileStatus) != 0)
+        return;
+
+    m_size = static_cast<uint64_t>(fileStatus.st_size);
+    m_isOpen = true;
+
+    // Empty files can not be mapped
+    if (m_size == 0)
+        return;
+
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_file, 0);
+
+    if (data == MAP_FAILED) {
+        m_size = 0;
+        m_isOpen = false;
+        return;
+    }
+
+    madvise(data, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const char*>(data);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data)
+        munmap(const_cast<char*>(m_data), m_size);
+
+    if (m_file >= 0)
+        close(m_file);
+}
+
+#endif
+
+bool MappedFile::isOpen() const
+{
+    return m_isOpen;
+}
+
+std::string_view MappedFile::view() const
+{
+    return m_data ? std::string_view(m_data, m_size) : std::string_view {};
+}
+
+uint64_t MappedFile::size() const
+{
+    return m_size;
+}
+
+uint64_t MappedFile::hash() const
+{
+    // Four independent lanes hash 32 bytes per step so the loop is limited by memory bandwidth
+    std::array<uint64_t, 4> lanes { HASH_PRIME_1, HASH_PRIME_2, ~HASH_PRIME_1, ~HASH_PRIME_2 };
+    std::array<uint64_t, 4> words {};
+    uint64_t position {};
+
+    for (; position + sizeof(words) <= m_size; position += sizeof(words)) {
+        std::memcpy(words.data(), m_data + position, sizeof(words));
+
+        for (uint64_t i {}; i < lanes.size(); ++i)
+            lanes[i] = mix(lanes[i], words[i]);
+    }
+
+    uint64_t result = m_size * HASH_PRIME_1;
+
+    for (uint64_t lane : lanes)
+        result = mix(result, lane);
+
+    for (; position < m_size; ++position)
+        result = mix(result, static_cast<unsigned char>(m_data[position]));
+
+    return result ^ (result >> 29);
+}
@@ -0,0 +1,536 @@
+// STL Libs
+#include <algorithm>
+#include <cmath>
+
+// Project Libs
+#include "../include/multigrid_solver.h"
+
+// Levels with fewer rows are solved directly
+constexpr static uint64_t COARSEST_SIZE = 400;
+// Max rows of the coarsest level to be factored as dense matrix
+constexpr static uint64_t MAX_DENSE_SIZE = 4000;
+// Max number of levels of the hierarchy
+constexpr static uint64_t MAX_LEVELS = 25;
+// Gauss-seidel sweeps on the coarsest level when it is too large for dense factorization
+constexpr static uint64_t COARSEST_SWEEPS = 20;
+// Threshold of strong connection on the finest level: |a(i, j)| >= threshold * sqrt(a(i, i) * a(j, j)),
+// it is halved on every coarser level
+constexpr static Value STRENGTH_THRESHOLD = 0.25;
+
+/**
+ * @brief Transposes sparse matrix
+ *
+ * @param t_matrix matrix to transpose
+ * @return SparseMatrix transposed matrix
+ */
+static SparseMatrix transpose(const SparseMatrix& t_matrix)
+{
+    SparseMatrix result {};
+    result.rowsSize = t_matrix.columnsSize;
+    result.columnsSize = t_matrix.rowsSize;
+    result.offsets.assign(result.rowsSize + 1, 0);
+    result.columns.resize(t_matrix.columns.size());
+    result.values.resize(t_matrix.values.size());
+
+    for (uint64_t column : t_matrix.columns)
+        ++result.offsets[column + 1];
+
+    for (uint64_t row {}; row < result.rowsSize; ++row)
+        result.offsets[row + 1] += result.offsets[row];
+
+    std::vector<uint64_t> fill(result.offsets.begin(), result.offsets.end() - 1);
+
+    for (uint64_t row {}; row < t_matrix.rowsSize; ++row) {
+        for (uint64_t k = t_matrix.offsets[row]; k < t_matrix.offsets[row + 1]; ++k) {
+            uint64_t position = fill[t_matrix.columns[k]]++;
+            result.columns[position] = row;
+            result.values[position] = t_matrix.values[k];
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Multiplies two sparse matrices
+ *
+ * @param t_first left matrix
+ * @param t_second right matrix
+ * @return SparseMatrix product of matrices
+ */
+static SparseMatrix multiply(const SparseMatrix& t_first, const SparseMatrix& t_second)
+{
+    SparseMatrix result {};
+    result.rowsSize = t_first.rowsSize;
+    result.columnsSize = t_second.columnsSize;
+    result.offsets.assign(result.rowsSize + 1, 0);
+
+    std::vector<uint64_t> positions(result.columnsSize, NO_ROW);
+
+    for (uint64_t row {}; row < t_first.rowsSize; ++row) {
+        uint64_t rowBegin = result.columns.size();
+
+        for (uint64_t i = t_first.offsets[row]; i < t_first.offsets[row + 1]; ++i) {
+            uint64_t middle = t_first.columns[i];
+
+            for (uint64_t j = t_second.offsets[middle]; j < t_second.offsets[middle + 1]; ++j) {
+                uint64_t column = t_second.columns[j];
+                Value product = t_first.values[i] * t_second.values[j];
+
+                if (positions[column] == NO_ROW || positions[column] < rowBegin) {
+                    positions[column] = result.columns.size();
+                    result.columns.push_back(column);
+                    result.values.push_back(product);
+                } else {
+                    result.values[positions[column]] += product;
+                }
+            }
+        }
+
+        result.offsets[row + 1] = result.columns.size();
+    }
+
+    return result;
+}
+
+/**
+ * @brief Multiplies sparse matrix by vector
+ *
+ * @param t_matrix matrix to multiply
+ * @param t_vector vector to multiply
+ * @param t_result product
+ */
+static void multiply(const SparseMatrix& t_matrix, const std::vector<Value>& t_vector, std::vector<Value>& t_result)
+{
+    for (uint64_t row {}; row < t_matrix.rowsSize; ++row) {
+        Value sum {};
+
+        for (uint64_t k = t_matrix.offsets[row]; k < t_matrix.offsets[row + 1]; ++k)
+            sum += t_matrix.values[k] * t_vector[t_matrix.columns[k]];
+
+        t_result[row] = sum;
+    }
+}
+
+MultigridSolver::MultigridSolver(const ConductanceMatrix& t_matrix)
+{
+    const uint64_t rowsSize = t_matrix.size();
+    MultigridLevel finest {};
+    auto& matrix = finest.matrix;
+
+    matrix.rowsSize = rowsSize;
+    matrix.columnsSize = rowsSize;
+    matrix.offsets.assign(rowsSize + 1, 0);
+
+    // Finest level is the conductance matrix with merged parallel resistors and diagonal in rows
+    std::vector<uint64_t> positions(rowsSize, NO_ROW);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        uint64_t rowBegin = matrix.columns.size();
+
+        positions[row] = matrix.columns.size();
+        matrix.columns.push_back(row);
+        matrix.values.push_back(t_matrix.diagonal[row]);
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k) {
+            uint64_t column = t_matrix.columnIndices[k];
+
+            if (positions[column] == NO_ROW || positions[column] < rowBegin) {
+                positions[column] = matrix.columns.size();
+                matrix.columns.push_back(column);
+                matrix.values.push_back(-t_matrix.conductances[k]);
+            } else {
+                matrix.values[positions[column]] -= t_matrix.conductances[k];
+            }
+        }
+
+        matrix.offsets[row + 1] = matrix.columns.size();
+    }
+
+    m_levels.push_back(std::move(finest));
+
+    while (coarsen())
+        ;
+
+    for (auto& level : m_levels) {
+        const uint64_t levelRowsSize = level.matrix.rowsSize;
+
+        level.inverseDiagonal.assign(levelRowsSize, 0);
+
+        for (uint64_t row {}; row < levelRowsSize; ++row) {
+            for (uint64_t k = level.matrix.offsets[row]; k < level.matrix.offsets[row + 1]; ++k) {
+                if (level.matrix.columns[k] == row)
+                    level.inverseDiagonal[row] = 1.0 / level.matrix.values[k];
+            }
+        }
+    }
+
+    factorCoarsest();
+}
+
+uint64_t MultigridSolver::levelsSize() const
+{
+    return m_levels.size();
+}
+
+Value MultigridSolver::operatorComplexity() const
+{
+    Value totalNonZeros {};
+
+    for (const auto& level : m_levels)
+        totalNonZeros += level.matrix.values.size();
+
+    return totalNonZeros / std::max<Value>(1.0, m_levels.front().matrix.values.size());
+}
+
+bool MultigridSolver::coarsen()
+{
+    const auto& fine = m_levels.back().matrix;
+    const uint64_t rowsSize = fine.rowsSize;
+
+    if (rowsSize <= COARSEST_SIZE || m_levels.size() >= MAX_LEVELS)
+        return false;
+
+    std::vector<Value> diagonal(rowsSize);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (fine.columns[k] == row)
+                diagonal[row] += fine.values[k];
+        }
+    }
+
+    const Value strengthThreshold = STRENGTH_THRESHOLD * std::pow(0.5, m_levels.size() - 1);
+
+    auto isStrong = [&](uint64_t t_row, uint64_t t_k) {
+        uint64_t column = fine.columns[t_k];
+        return column != t_row
+            && std::fabs(fine.values[t_k]) >= strengthThreshold * std::sqrt(diagonal[t_row] * diagonal[column]);
+    };
+
+    // Aggregation: roots with free strong neighborhoods, then attach leftovers to neighboring aggregates
+    std::vector<uint64_t> aggregates(rowsSize, NO_ROW);
+    uint64_t aggregatesSize {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        if (aggregates[row] != NO_ROW)
+            continue;
+
+        bool isFree = true;
+        bool hasStrong = false;
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1] && isFree; ++k) {
+            if (isStrong(row, k)) {
+                hasStrong = true;
+                isFree = aggregates[fine.columns[k]] == NO_ROW;
+            }
+        }
+
+        if (!isFree || !hasStrong)
+            continue;
+
+        aggregates[row] = aggregatesSize;
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (isStrong(row, k))
+                aggregates[fine.columns[k]] = aggregatesSize;
+        }
+
+        ++aggregatesSize;
+    }
+
+    std::vector<uint64_t> rootAggregates = aggregates;
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        if (aggregates[row] != NO_ROW)
+            continue;
+
+        Value strongest {};
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            uint64_t column = fine.columns[k];
+
+            if (isStrong(row, k) && rootAggregates[column] != NO_ROW && std::fabs(fine.values[k]) > strongest) {
+                strongest = std::fabs(fine.values[k]);
+                aggregates[row] = rootAggregates[column];
+            }
+        }
+    }
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        if (aggregates[row] != NO_ROW)
+            continue;
+
+        aggregates[row] = aggregatesSize;
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (isStrong(row, k) && aggregates[fine.columns[k]] == NO_ROW)
+                aggregates[fine.columns[k]] = aggregatesSize;
+        }
+
+        ++aggregatesSize;
+    }
+
+    if (aggregatesSize * 10 > rowsSize * 9)
+        return false;
+
+    // Smoothed prolongation: P = (I - omega * D^-1 * A_F) * P_tentative, omega = 4 / (3 * rho(D^-1 * A_F)).
+    // A_F keeps strong connections only, weak ones are lumped into the diagonal to limit fill of coarse levels.
+    std::vector<Value> filteredDiagonal(diagonal);
+    Value spectralRadius {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (fine.columns[k] != row && !isStrong(row, k))
+                filteredDiagonal[row] += fine.values[k];
+        }
+
+        Value rowSum = std::fabs(filteredDiagonal[row]);
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (isStrong(row, k))
+                rowSum += std::fabs(fine.values[k]);
+        }
+
+        if (filteredDiagonal[row] <= 0)
+            filteredDiagonal[row] = diagonal[row];
+
+        spectralRadius = std::max(spectralRadius, rowSum / filteredDiagonal[row]);
+    }
+
+    const Value omega = 4.0 / (3.0 * spectralRadius);
+
+    SparseMatrix prolongation {};
+    prolongation.rowsSize = rowsSize;
+    prolongation.columnsSize = aggregatesSize;
+    prolongation.offsets.assign(rowsSize + 1, 0);
+
+    std::vector<uint64_t> positions(aggregatesSize, NO_ROW);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        uint64_t rowBegin = prolongation.columns.size();
+
+        positions[aggregates[row]] = prolongation.columns.size();
+        prolongation.columns.push_back(aggregates[row]);
+        prolongation.values.push_back(1.0 - omega);
+
+        for (uint64_t k = fine.offsets[row]; k < fine.offsets[row + 1]; ++k) {
+            if (!isStrong(row, k))
+                continue;
+
+            uint64_t column = aggregates[fine.columns[k]];
+            Value value = -omega * fine.values[k] / filteredDiagonal[row];
+
+            if (positions[column] == NO_ROW || positions[column] < rowBegin) {
+                positions[column] = prolongation.columns.size();
+                prolongation.columns.push_back(column);
+                prolongation.values.push_back(value);
+            } else {
+                prolongation.values[positions[column]] += value;
+            }
+        }
+
+        prolongation.offsets[row + 1] = prolongation.columns.size();
+    }
+
+    MultigridLevel coarse {};
+    coarse.matrix = multiply(transpose(prolongation), multiply(fine, prolongation));
+
+    m_levels.back().restriction = transpose(prolongation);
+    m_levels.back().prolongation = std::move(prolongation);
+    m_levels.push_back(std::move(coarse));
+
+    return true;
+}
+
+void MultigridSolver::factorCoarsest()
+{
+    const auto& matrix = m_levels.back().matrix;
+    const uint64_t rowsSize = matrix.rowsSize;
+
+    m_coarseFactor.clear();
+
+    if (rowsSize > MAX_DENSE_SIZE)
+        return;
+
+    m_coarseFactor.assign(rowsSize * rowsSize, 0);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        for (uint64_t k = matrix.offsets[row]; k < matrix.offsets[row + 1]; ++k)
+            m_coarseFactor[row * rowsSize + matrix.columns[k]] += matrix.values[k];
+    }
+
+    // Dense cholesky, lower triangle in row major order
+    for (uint64_t j {}; j < rowsSize; ++j) {
+        Value pivot = m_coarseFactor[j * rowsSize + j];
+
+        for (uint64_t k {}; k < j; ++k)
+            pivot -= m_coarseFactor[j * rowsSize + k] * m_coarseFactor[j * rowsSize + k];
+
+        if (pivot <= 0) {
+            m_coarseFactor.clear();
+            return;
+        }
+
+        m_coarseFactor[j * rowsSize + j] = std::sqrt(pivot);
+
+        for (uint64_t i = j + 1; i < rowsSize; ++i) {
+            Value sum = m_coarseFactor[i * rowsSize + j];
+
+            for (uint64_t k {}; k < j; ++k)
+                sum -= m_coarseFactor[i * rowsSize + k] * m_coarseFactor[j * rowsSize + k];
+
+            m_coarseFactor[i * rowsSize + j] = sum / m_coarseFactor[j * rowsSize + j];
+        }
+    }
+}
+
+void MultigridSolver::smooth(const MultigridLevel& t_level, const std::vector<Value>& t_rightHandSide,
+    std::vector<Value>& t_solution, const bool& t_isForward) const
+{
+    const auto& matrix = t_level.matrix;
+    const uint64_t rowsSize = matrix.rowsSize;
+
+    for (uint64_t i {}; i < rowsSize; ++i) {
+        uint64_t row = t_isForward ? i : rowsSize - 1 - i;
+        Value sum {};
+
+        for (uint64_t k = matrix.offsets[row]; k < matrix.offsets[row + 1]; ++k)
+            sum += matrix.values[k] * t_solution[matrix.columns[k]];
+
+        t_solution[row] += (t_rightHandSide[row] - sum) * t_level.inverseDiagonal[row];
+    }
+}
+
+void MultigridSolver::cycle(const uint64_t& t_level, MultigridWorkspace& t_workspace) const
+{
+    const auto& level = m_levels[t_level];
+    const auto& rightHandSide = t_workspace.rightHandSides[t_level];
+    auto& solution = t_workspace.solutions[t_level];
+    auto& residual = t_workspace.residuals[t_level];
+
+    if (t_level + 1 == m_levels.size()) {
+        const uint64_t rowsSize = level.matrix.rowsSize;
+
+        if (m_coarseFactor.empty()) {
+            for (uint64_t sweep {}; sweep < COARSEST_SWEEPS; ++sweep) {
+                smooth(level, rightHandSide, solution, true);
+                smooth(level, rightHandSide, solution, false);
+            }
+
+            return;
+        }
+
+        for (uint64_t i {}; i < rowsSize; ++i) {
+            Value sum = rightHandSide[i];
+
+            for (uint64_t k {}; k < i; ++k)
+                sum -= m_coarseFactor[i * rowsSize + k] * solution[k];
+
+            solution[i] = sum / m_coarseFactor[i * rowsSize + i];
+        }
+
+        for (uint64_t i = rowsSize; i-- > 0;) {
+            Value sum = solution[i];
+
+            for (uint64_t k = i + 1; k < rowsSize; ++k)
+                sum -= m_coarseFactor[k * rowsSize + i] * solution[k];
+
+            solution[i] = sum / m_coarseFactor[i * rowsSize + i];
+        }
+
+        return;
+    }
+
+    auto& coarseSolution = t_workspace.solutions[t_level + 1];
+
+    smooth(level, rightHandSide, solution, true);
+
+    multiply(level.matrix, solution, residual);
+
+    for (uint64_t row {}; row < level.matrix.rowsSize; ++row)
+        residual[row] = rightHandSide[row] - residual[row];
+
+    multiply(level.restriction, residual, t_workspace.rightHandSides[t_level + 1]);
+    std::fill(coarseSolution.begin(), coarseSolution.end(), 0.0);
+
+    cycle(t_level + 1, t_workspace);
+
+    // Prolongation of the coarse correction, residual is reused as temporary storage
+    multiply(level.prolongation, coarseSolution, residual);
+
+    for (uint64_t row {}; row < level.matrix.rowsSize; ++row)
+        solution[row] += residual[row];
+
+    smooth(level, rightHandSide, solution, false);
+}
+
+void MultigridSolver::prepareWorkspace(MultigridWorkspace& t_workspace) const
+{
+    t_workspace.solutions.resize(m_levels.size());
+    t_workspace.rightHandSides.resize(m_levels.size());
+    t_workspace.residuals.resize(m_levels.size());
+
+    for (uint64_t i {}; i < m_levels.size(); ++i) {
+        t_workspace.solutions[i].resize(m_levels[i].matrix.rowsSize);
+        t_workspace.rightHandSides[i].resize(m_levels[i].matrix.rowsSize);
+        t_workspace.residuals[i].resize(m_levels[i].matrix.rowsSize);
+    }
+}
+
+void MultigridSolver::applyCycle(const std::vector<Value>& t_rightHandSide, std::vector<Value>& t_solution,
+    MultigridWorkspace& t_workspace) const
+{
+    auto& solution = t_workspace.solutions.front();
+
+    std::copy(t_rightHandSide.begin(), t_rightHandSide.end(), t_workspace.rightHandSides.front().begin());
+    std::fill(solution.begin(), solution.end(), 0.0);
+
+    cycle(0, t_workspace);
+
+    std::copy(solution.begin(), solution.end(), t_solution.begin());
+}
+
+uint64_t MultigridSolver::solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision,
+    const uint64_t& t_maxIterations, Value& t_residual) const
+{
+    const uint64_t rowsSize = t_matrix.size();
+    const auto& finest = m_levels.front();
+    auto& workspace = t_state.multigridWorkspace;
+    prepareWorkspace(workspace);
+    auto& rightHandSide = workspace.rightHandSides.front();
+    auto& solution = workspace.solutions.front();
+    auto& product = t_state.workProducts;
+    product.resize(rowsSize);
+    uint64_t totalIterations {};
+    Value rightHandSideNorm {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        rightHandSide[row] = t_matrix.fixedCurrents[row] - t_state.currents[row];
+        rightHandSideNorm += rightHandSide[row] * rightHandSide[row];
+    }
+
+    rightHandSideNorm = rightHandSideNorm > 0 ? std::sqrt(rightHandSideNorm) : 1.0;
+    std::copy(t_state.values.begin(), t_state.values.end(), solution.begin());
+
+    for (;; ++totalIterations) {
+        Value residualNorm {};
+        multiply(finest.matrix, solution, product);
+
+        for (uint64_t row {}; row < rowsSize; ++row) {
+            Value residual = rightHandSide[row] - product[row];
+            residualNorm += residual * residual;
+        }
+
+        t_residual = std::sqrt(residualNorm) / rightHandSideNorm;
+
+        if (t_residual < t_precision || totalIterations >= t_maxIterations)
+            break;
+
+        cycle(0, workspace);
+    }
+
+    std::copy(solution.begin(), solution.end(), t_state.values.begin());
+
+    return totalIterations;
+}
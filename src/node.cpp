@@ -1,138 +1,115 @@
-// STL libs
-#include <algorithm>
-#include <cmath>
-
 // Project libs
-#include "../include/current_source.h"
+#include "../include/buffered_writer.h"
 #include "../include/node.h"
-#include "../include/resistor.h"
-#include "../include/voltage_source.h"
 
-Node::Node(const NodeCoords& t_node, const Name& t_name)
-    : m_layer((uint8_t)t_node[0])
-    , m_x(t_node[1])
-    , m_y(t_node[2])
-    , name(t_name) {};
+Node::Node(const NodeStore& t_store, const uint64_t& t_id)
+    : m_store(&t_store)
+    , m_id(t_id) {};
 
-void Node::addInverseSumOfResistance(const Value& t_resistance)
+uint64_t Node::id() const
 {
-    m_inverseSumOfResistance += 1.0 / t_resistance;
+    return m_id;
 }
 
-NodeCoords Node::getCoordinates()
+NodeCoords Node::getCoordinates() const
 {
-    return NodeCoords({ m_layer, m_x, m_y });
+    return m_store->getCoordinates(m_id);
 };
 
-void Node::connectResistor(const ResistorPtr& t_resistor)
+Name Node::getName() const
 {
-    m_connectedResistors.push_back(t_resistor);
-};
+    auto coordinates = getCoordinates();
 
-void Node::connectCurrentSource(const CurrentSourcePtr& t_currentSource)
-{
-    m_connectedCurrentSources.push_back(t_currentSource);
-};
+    // Ground node is the only one without coordinates
+    if (coordinates[0] == 0 && coordinates[1] == 0 && coordinates[2] == 0)
+        return "0";
 
-void Node::connectVoltageSource(const VoltageSourcePtr& t_voltageSource)
-{
-    m_connectedVoltageSources.push_back(t_voltageSource);
+    return "n1_m" + std::to_string(coordinates[0]) + "_" + std::to_string(coordinates[1]) + "_"
+        + std::to_string(coordinates[2]);
 };
 
-void Node::disconnectCurrentSource(const CurrentSourcePtr& t_currentSource)
+void Node::writeName(BufferedWriter& t_writer) const
 {
-    auto targetCurrentSourceName = t_currentSource->name;
-
-    for (auto it = m_connectedCurrentSources.begin(); it != m_connectedCurrentSources.end();) {
-        auto currentSourceName = (*it)->name;
+    auto coordinates = getCoordinates();
 
-        if (currentSourceName == targetCurrentSourceName) {
-            m_connectedCurrentSources.erase(it);
-            break;
-        }
+    if (coordinates[0] == 0 && coordinates[1] == 0 && coordinates[2] == 0)
+        t_writer.write('0');
+    else
+        t_writer.writeNodeName(coordinates);
+};
 
-        ++it;
-    }
+bool Node::hasFlag(const uint8_t& t_flag) const
+{
+    return m_store->hasFlag(m_id, t_flag);
 }
 
-void Node::disconnectVoltageSource(const VoltageSourcePtr& t_voltageSource)
+Value Node::value() const
 {
-    auto targetVoltageSourceName = t_voltageSource->name;
-
-    for (auto it = m_connectedVoltageSources.begin(); it != m_connectedVoltageSources.end();) {
-        auto voltageSourceName = (*it)->name;
-
-        if (voltageSourceName == targetVoltageSourceName) {
-            m_connectedVoltageSources.erase(it);
-            break;
-        }
-
-        ++it;
-    }
+    return m_store->values[m_id];
 }
 
-bool Node::isViaNode()
+Value Node::realValue() const
 {
-    for (const auto& resistor : m_connectedResistors) {
-        if (resistor->isViaResistor()) {
-            return true;
-        }
-    }
-
-    return false;
+    return m_store->realValues[m_id];
 }
 
-void Node::initializationDC()
+uint64_t NodeStore::size() const
 {
-    if (isVoltageNode)
-        return;
-
-    Value sumOfNodes {};
-
-    for (uint16_t i {}; i < m_connectedResistors.size(); ++i)
-        sumOfNodes += neighborNodes[i]->value / m_connectedResistors[i]->value;
-
-    for (auto& currentSource : m_connectedCurrentSources)
-        m_sumOfCurrent += currentSource->value;
-
-    value = (m_sumOfCurrent - sumOfNodes) / m_inverseSumOfResistance;
+    return layers.size();
 }
 
-void Node::reinitializationDC()
+void NodeStore::reserve(const uint64_t& t_size)
 {
-    if (isVoltageNode)
-        return;
-
-    m_sumOfCurrent = 0;
-
-    for (auto& currentSource : m_connectedCurrentSources)
-        m_sumOfCurrent += currentSource->value;
+    layers.reserve(t_size);
+    xs.reserve(t_size);
+    ys.reserve(t_size);
+    flags.reserve(t_size);
+    values.reserve(t_size);
+    realValues.reserve(t_size);
 }
 
-int Node::stepDC(const Value& t_precision)
+void NodeStore::shrinkToFit()
 {
-    if (isVoltageNode)
-        return 1;
-
-    Value sumOfNodes {};
-    Value previousValue = value;
+    layers.shrink_to_fit();
+    xs.shrink_to_fit();
+    ys.shrink_to_fit();
+    flags.shrink_to_fit();
+    values.shrink_to_fit();
+    realValues.shrink_to_fit();
+}
 
-    for (uint8_t i {}; i < m_connectedResistors.size(); ++i) {
-        sumOfNodes += neighborNodes[i]->value / m_connectedResistors[i]->value;
-    }
+uint64_t NodeStore::add(const NodeCoords& t_nodeCoords)
+{
+    layers.push_back(static_cast<L>(t_nodeCoords[0]));
+    xs.push_back(t_nodeCoords[1]);
+    ys.push_back(t_nodeCoords[2]);
+    flags.push_back(0);
+    values.push_back(0);
+    realValues.push_back(0);
+
+    return layers.size() - 1;
+}
 
-    value = (sumOfNodes - m_sumOfCurrent) / m_inverseSumOfResistance;
+bool NodeStore::hasFlag(const uint64_t& t_id, const uint8_t& t_flag) const
+{
+    return flags[t_id] & t_flag;
+}
 
-    if (std::fabs(value - previousValue) < t_precision)
-        return 1;
+void NodeStore::setFlag(const uint64_t& t_id, const uint8_t& t_flag, const bool& t_isSet)
+{
+    if (t_isSet)
+        flags[t_id] |= t_flag;
+    else
+        flags[t_id] &= ~t_flag;
+}
 
-    return 0;
+NodeCoords NodeStore::getCoordinates(const uint64_t& t_id) const
+{
+    return NodeCoords({ layers[t_id], xs[t_id], ys[t_id] });
 }
 
-void Node::fullyDisconnection()
+uint64_t NodeStore::memorySize() const
 {
-    m_connectedResistors.clear();
-    m_connectedCurrentSources.clear();
-    m_connectedVoltageSources.clear();
-    neighborNodes.clear();
-};
\ No newline at end of file
+    return sizeof(NodeStore) + layers.capacity() * sizeof(L) + xs.capacity() * sizeof(X) + ys.capacity() * sizeof(Y)
+        + flags.capacity() * sizeof(uint8_t) + values.capacity() * sizeof(Value) + realValues.capacity() * sizeof(Value);
+}
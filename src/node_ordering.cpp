@@ -0,0 +1,263 @@
+// STL Libs
+#include <algorithm>
+#include <numeric>
+
+// Project Libs
+#include "../include/node_ordering.h"
+
+// Max number of breadth first searches to find a pseudo peripheral node of one component
+constexpr static uint64_t MAX_PERIPHERAL_SEARCHES = 8;
+
+/**
+ * @brief Spreads the lower 32 bits of the value to even bits.
+ *
+ * @param t_value value to spread.
+ * @return uint64_t - spread value.
+ */
+static inline uint64_t spreadBits(uint64_t t_value)
+{
+    t_value &= 0x00000000FFFFFFFFULL;
+    t_value = (t_value | (t_value << 16)) & 0x0000FFFF0000FFFFULL;
+    t_value = (t_value | (t_value << 8)) & 0x00FF00FF00FF00FFULL;
+    t_value = (t_value | (t_value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    t_value = (t_value | (t_value << 2)) & 0x3333333333333333ULL;
+    t_value = (t_value | (t_value << 1)) & 0x5555555555555555ULL;
+
+    return t_value;
+}
+
+std::vector<uint64_t> NodeOrdering::order(const NodeStore& t_nodes, const ResistorStore& t_resistors,
+    const std::vector<uint64_t>& t_orderNodes, const OrderingType& t_type)
+{
+    switch (t_type) {
+    case OrderingType::Morton:
+    case OrderingType::Hilbert:
+        return orderByCurve(t_nodes, t_orderNodes, t_type);
+
+    case OrderingType::ReverseCuthillMcKee:
+        return orderByReverseCuthillMcKee(t_nodes, t_resistors, t_orderNodes);
+
+    default:
+        return t_orderNodes;
+    }
+}
+
+std::vector<uint64_t> NodeOrdering::orderByCurve(const NodeStore& t_nodes, const std::vector<uint64_t>& t_orderNodes,
+    const OrderingType& t_type)
+{
+    std::vector<uint32_t> xs {};
+    std::vector<uint32_t> ys {};
+
+    xs.reserve(t_orderNodes.size());
+    ys.reserve(t_orderNodes.size());
+
+    for (uint64_t node : t_orderNodes) {
+        xs.push_back(t_nodes.xs[node]);
+        ys.push_back(t_nodes.ys[node]);
+    }
+
+    // Coordinates are replaced by their ranks, so the curve is dense even when the pitch of the grid is large
+    std::sort(xs.begin(), xs.end());
+    xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+    std::sort(ys.begin(), ys.end());
+    ys.erase(std::unique(ys.begin(), ys.end()), ys.end());
+
+    uint32_t bits {};
+
+    while ((uint64_t(1) << bits) < std::max(xs.size(), ys.size()))
+        ++bits;
+
+    // Index on the curve, layer and id of every node
+    std::vector<std::array<uint64_t, 3>> keys {};
+    keys.reserve(t_orderNodes.size());
+
+    for (uint64_t node : t_orderNodes) {
+        uint32_t x = std::lower_bound(xs.begin(), xs.end(), t_nodes.xs[node]) - xs.begin();
+        uint32_t y = std::lower_bound(ys.begin(), ys.end(), t_nodes.ys[node]) - ys.begin();
+        uint64_t index = t_type == OrderingType::Morton ? mortonIndex(x, y) : hilbertIndex(x, y, bits);
+
+        keys.push_back({ index, t_nodes.layers[node], node });
+    }
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<uint64_t> orderedNodes {};
+    orderedNodes.reserve(keys.size());
+
+    for (const auto& key : keys)
+        orderedNodes.push_back(key[2]);
+
+    return orderedNodes;
+}
+
+std::vector<uint64_t> NodeOrdering::orderByReverseCuthillMcKee(const NodeStore& t_nodes,
+    const ResistorStore& t_resistors, const std::vector<uint64_t>& t_orderNodes)
+{
+    const uint64_t size = t_orderNodes.size();
+    std::vector<uint64_t> positions(t_nodes.size(), NO_POSITION);
+
+    for (uint64_t i {}; i < size; ++i)
+        positions[t_orderNodes[i]] = i;
+
+    // Graph of the ordered nodes in compressed sparse row format, resistors to other nodes are skipped
+    std::vector<uint64_t> offsets(size + 1);
+    std::vector<uint64_t> neighbors {};
+
+    for (uint64_t i {}; i < t_resistors.size(); ++i) {
+        uint64_t first = positions[t_resistors.firstNodes[i]];
+        uint64_t second = positions[t_resistors.secondNodes[i]];
+
+        if (first != NO_POSITION && second != NO_POSITION && first != second) {
+            ++offsets[first + 1];
+            ++offsets[second + 1];
+        }
+    }
+
+    for (uint64_t i {}; i < size; ++i)
+        offsets[i + 1] += offsets[i];
+
+    neighbors.resize(offsets.back());
+    std::vector<uint64_t> fill(offsets.begin(), offsets.end() - 1);
+
+    for (uint64_t i {}; i < t_resistors.size(); ++i) {
+        uint64_t first = positions[t_resistors.firstNodes[i]];
+        uint64_t second = positions[t_resistors.secondNodes[i]];
+
+        if (first != NO_POSITION && second != NO_POSITION && first != second) {
+            neighbors[fill[first]++] = second;
+            neighbors[fill[second]++] = first;
+        }
+    }
+
+    auto degree = [&](const uint64_t& t_node) { return offsets[t_node + 1] - offsets[t_node]; };
+    auto isLowerDegree = [&](const uint64_t& t_first, const uint64_t& t_second) {
+        return degree(t_first) < degree(t_second);
+    };
+
+    std::vector<uint64_t> order {};
+    std::vector<uint8_t> isVisited(size);
+    std::vector<uint64_t> searchMarks(size, NO_POSITION);
+    std::vector<uint64_t> queue {};
+    uint64_t searchIndex {};
+
+    // Breadth first search inside the unvisited component, gives the depth and the min degree node of the last level
+    auto searchLevels = [&](const uint64_t& t_start, uint64_t& t_lastNode) {
+        uint64_t depth {};
+        uint64_t levelBegin {};
+
+        queue.clear();
+        queue.push_back(t_start);
+        searchMarks[t_start] = searchIndex;
+
+        while (true) {
+            uint64_t levelEnd = queue.size();
+            t_lastNode = *std::min_element(queue.begin() + levelBegin, queue.begin() + levelEnd, isLowerDegree);
+
+            for (uint64_t k = levelBegin; k < levelEnd; ++k) {
+                for (uint64_t j = offsets[queue[k]]; j < offsets[queue[k] + 1]; ++j) {
+                    uint64_t neighbor = neighbors[j];
+
+                    if (!isVisited[neighbor] && searchMarks[neighbor] != searchIndex) {
+                        searchMarks[neighbor] = searchIndex;
+                        queue.push_back(neighbor);
+                    }
+                }
+            }
+
+            if (queue.size() == levelEnd)
+                break;
+
+            levelBegin = levelEnd;
+            ++depth;
+        }
+
+        ++searchIndex;
+
+        return depth;
+    };
+
+    std::vector<uint64_t> nodesByDegree(size);
+    std::iota(nodesByDegree.begin(), nodesByDegree.end(), 0);
+    std::stable_sort(nodesByDegree.begin(), nodesByDegree.end(), isLowerDegree);
+    order.reserve(size);
+
+    for (uint64_t candidate : nodesByDegree) {
+        if (isVisited[candidate])
+            continue;
+
+        // Start of the component is moved to the last level while the depth grows
+        uint64_t start = candidate;
+        uint64_t lastNode {};
+        uint64_t depth = searchLevels(start, lastNode);
+
+        for (uint64_t i {}; i < MAX_PERIPHERAL_SEARCHES && lastNode != start; ++i) {
+            uint64_t nextLastNode {};
+            uint64_t nextDepth = searchLevels(lastNode, nextLastNode);
+
+            if (nextDepth <= depth)
+                break;
+
+            start = lastNode;
+            depth = nextDepth;
+            lastNode = nextLastNode;
+        }
+
+        uint64_t head = order.size();
+        order.push_back(start);
+        isVisited[start] = true;
+
+        while (head < order.size()) {
+            uint64_t node = order[head++];
+            uint64_t levelBegin = order.size();
+
+            for (uint64_t j = offsets[node]; j < offsets[node + 1]; ++j) {
+                if (!isVisited[neighbors[j]]) {
+                    isVisited[neighbors[j]] = true;
+                    order.push_back(neighbors[j]);
+                }
+            }
+
+            std::stable_sort(order.begin() + levelBegin, order.end(), isLowerDegree);
+        }
+    }
+
+    std::vector<uint64_t> orderedNodes {};
+    orderedNodes.reserve(size);
+
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+        orderedNodes.push_back(t_orderNodes[*it]);
+
+    return orderedNodes;
+}
+
+uint64_t NodeOrdering::mortonIndex(const uint32_t& t_x, const uint32_t& t_y)
+{
+    return spreadBits(t_x) | (spreadBits(t_y) << 1);
+}
+
+uint64_t NodeOrdering::hilbertIndex(const uint32_t& t_x, const uint32_t& t_y, const uint32_t& t_bits)
+{
+    uint64_t index {};
+    uint64_t x = t_x;
+    uint64_t y = t_y;
+    const uint64_t side = uint64_t(1) << t_bits;
+
+    // Quadrant of every level adds its part of the curve, the rest of the square is rotated into the base orientation
+    for (uint64_t half = side >> 1; half > 0; half >>= 1) {
+        uint64_t rx = (x & half) ? 1 : 0;
+        uint64_t ry = (y & half) ? 1 : 0;
+
+        index += half * half * ((3 * rx) ^ ry);
+
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+
+            std::swap(x, y);
+        }
+    }
+
+    return index;
+}
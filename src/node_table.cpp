@@ -0,0 +1,111 @@
+// STL Libs
+#include <algorithm>
+#include <stdexcept>
+
+// Project Libs
+#include "../include/node_table.h"
+
+// Empty slot of the table, no valid key has all bits set
+constexpr static uint64_t EMPTY_KEY = std::numeric_limits<uint64_t>::max();
+// Bits of every coordinate in the packed key
+constexpr static uint64_t COORDINATE_BITS = 28;
+// Smallest capacity of the table
+constexpr static uint64_t MIN_CAPACITY = 16;
+
+/**
+ * @brief Mixes bits of the key so that neighbor coordinates do not collide in the table
+ *
+ * @param t_key key to mix
+ * @return uint64_t mixed key
+ */
+static inline uint64_t hash(uint64_t t_key)
+{
+    t_key ^= t_key >> 33;
+    t_key *= 0xff51afd7ed558ccdULL;
+    t_key ^= t_key >> 33;
+    t_key *= 0xc4ceb9fe1a85ec53ULL;
+    t_key ^= t_key >> 33;
+
+    return t_key;
+}
+
+NodeTable::NodeTable(const uint64_t& t_expectedSize)
+{
+    uint64_t capacity = MIN_CAPACITY;
+
+    while (capacity < 2 * t_expectedSize)
+        capacity *= 2;
+
+    m_keys.assign(capacity, EMPTY_KEY);
+    m_indexes.resize(capacity);
+}
+
+uint64_t NodeTable::packKey(const NodeCoords& t_nodeCoords)
+{
+    constexpr uint64_t MAX_COORDINATE = (1ULL << COORDINATE_BITS) - 1;
+
+    if (t_nodeCoords[0] > 0xff || t_nodeCoords[1] > MAX_COORDINATE || t_nodeCoords[2] > MAX_COORDINATE)
+        throw std::runtime_error("Node coordinates are out of range: m" + std::to_string(t_nodeCoords[0]) + "_"
+            + std::to_string(t_nodeCoords[1]) + "_" + std::to_string(t_nodeCoords[2]));
+
+    return (static_cast<uint64_t>(t_nodeCoords[0]) << (2 * COORDINATE_BITS))
+        | (static_cast<uint64_t>(t_nodeCoords[1]) << COORDINATE_BITS) | t_nodeCoords[2];
+}
+
+uint64_t NodeTable::insert(const uint64_t& t_key, const uint64_t& t_index)
+{
+    if (2 * (m_size + 1) > m_keys.size())
+        grow();
+
+    const uint64_t mask = m_keys.size() - 1;
+
+    for (uint64_t slot = hash(t_key) & mask;; slot = (slot + 1) & mask) {
+        if (m_keys[slot] == t_key)
+            return m_indexes[slot];
+
+        if (m_keys[slot] == EMPTY_KEY) {
+            m_keys[slot] = t_key;
+            m_indexes[slot] = t_index;
+            ++m_size;
+
+            return t_index;
+        }
+    }
+}
+
+uint64_t NodeTable::find(const uint64_t& t_key) const
+{
+    if (m_keys.empty())
+        return NO_INDEX;
+
+    const uint64_t mask = m_keys.size() - 1;
+
+    for (uint64_t slot = hash(t_key) & mask;; slot = (slot + 1) & mask) {
+        if (m_keys[slot] == t_key)
+            return m_indexes[slot];
+
+        if (m_keys[slot] == EMPTY_KEY)
+            return NO_INDEX;
+    }
+}
+
+uint64_t NodeTable::size() const
+{
+    return m_size;
+}
+
+void NodeTable::grow()
+{
+    auto keys = std::move(m_keys);
+    auto indexes = std::move(m_indexes);
+    const uint64_t capacity = std::max(MIN_CAPACITY, 2 * keys.size());
+
+    m_keys.assign(capacity, EMPTY_KEY);
+    m_indexes.resize(capacity);
+    m_size = 0;
+
+    for (uint64_t slot {}; slot < keys.size(); ++slot) {
+        if (keys[slot] != EMPTY_KEY)
+            insert(keys[slot], indexes[slot]);
+    }
+}
@@ -0,0 +1,181 @@
+// STL Libs
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+// Project Libs
+#include "../include/buffered_writer.h"
+#include "../include/output_pipeline.h"
+
+OutputPipeline::OutputPipeline(const uint64_t& t_threads, const uint64_t& t_capacity, DatasetArchiveWriter* t_archive,
+    Rasterizer* t_rasterizer)
+    : m_capacity(std::max<uint64_t>(t_capacity, 1))
+    , m_archive(t_archive)
+    , m_rasterizer(t_rasterizer)
+{
+    for (uint64_t i {}; i < t_threads; ++i)
+        m_threads.emplace_back(&OutputPipeline::workerLoop, this);
+}
+
+OutputPipeline::~OutputPipeline()
+{
+    try {
+        finish();
+    } catch (...) {
+        // Errors of writers are reported by finish, nothing to do while unwinding
+    }
+}
+
+void OutputPipeline::push(std::unique_ptr<const PDNSnapshot> t_snapshot)
+{
+    const uint64_t memorySize = t_snapshot->memorySize();
+
+    if (m_threads.empty()) {
+        BufferedWriter writer {};
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_memorySize += memorySize;
+            m_peakMemorySize = std::max(m_peakMemorySize, m_memorySize);
+        }
+
+        // Without writers the pushing thread waits for the whole write
+        auto start = std::chrono::high_resolution_clock::now();
+        write(*t_snapshot, writer);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memorySize -= memorySize;
+        m_blockedDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        return;
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_pushCondition.wait(lock, [this] { return m_queue.size() < m_capacity || m_exception; });
+    auto end = std::chrono::high_resolution_clock::now();
+
+    m_blockedDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+
+    m_memorySize += memorySize;
+    m_peakMemorySize = std::max(m_peakMemorySize, m_memorySize);
+    m_queue.push_back(std::move(t_snapshot));
+    m_popCondition.notify_one();
+}
+
+void OutputPipeline::finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_popCondition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+
+    m_threads.clear();
+
+    if (m_exception)
+        std::rethrow_exception(std::exchange(m_exception, nullptr));
+}
+
+uint64_t OutputPipeline::getTotalLines() const
+{
+    return m_totalLines;
+}
+
+uint64_t OutputPipeline::getTotalSize() const
+{
+    return m_totalSize;
+}
+
+uint64_t OutputPipeline::getWritingDuration() const
+{
+    return m_writingDuration;
+}
+
+uint64_t OutputPipeline::getRasterizingDuration() const
+{
+    return m_rasterizingDuration;
+}
+
+uint64_t OutputPipeline::getBlockedDuration() const
+{
+    return m_blockedDuration;
+}
+
+uint64_t OutputPipeline::getPeakMemorySize() const
+{
+    return m_peakMemorySize;
+}
+
+void OutputPipeline::write(const PDNSnapshot& t_snapshot, BufferedWriter& t_writer)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    uint64_t totalLines {};
+    uint64_t totalSize {};
+
+    if (m_archive) {
+        totalSize = m_archive->append(t_snapshot);
+    } else {
+        totalLines = t_snapshot.writeNetlist(t_writer);
+        totalSize = t_writer.fileSize();
+        totalLines += t_snapshot.writeIRDrop(t_writer);
+        totalSize += t_writer.fileSize();
+    }
+
+    auto rasterizingStart = std::chrono::high_resolution_clock::now();
+
+    if (m_rasterizer && !t_snapshot.mapsFolderName.empty())
+        totalSize += m_rasterizer->writeFakeMaps(t_snapshot, t_snapshot.mapsFolderName);
+
+    auto end = std::chrono::high_resolution_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_totalLines += totalLines;
+    m_totalSize += totalSize;
+    m_writingDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    m_rasterizingDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - rasterizingStart).count();
+}
+
+void OutputPipeline::workerLoop()
+{
+    BufferedWriter writer {};
+
+    while (true) {
+        std::unique_ptr<const PDNSnapshot> snapshot {};
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_popCondition.wait(lock, [this] { return m_isStopping || !m_queue.empty(); });
+
+            if (m_queue.empty())
+                return;
+
+            snapshot = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        m_pushCondition.notify_one();
+
+        try {
+            write(*snapshot, writer);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (!m_exception)
+                m_exception = std::current_exception();
+
+            m_queue.clear();
+            m_pushCondition.notify_all();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_memorySize -= snapshot->memorySize();
+    }
+}
@@ -0,0 +1,213 @@
+// STL Libs
+#include <algorithm>
+#include <cmath>
+
+// Project Libs
+#include "../include/pcg_solver.h"
+#include "../include/vector_kernels.h"
+
+/**
+ * @brief Dot product of two vectors
+ *
+ * @param t_first first vector
+ * @param t_second second vector
+ * @return Value dot product
+ */
+static inline Value dot(const std::vector<Value>& t_first, const std::vector<Value>& t_second)
+{
+    return VectorKernels::dot(t_first.data(), t_second.data(), t_first.size());
+}
+
+PCGSolver::PCGSolver(const ConductanceMatrix& t_matrix, const PreconditionerType& t_preconditionerType)
+    : m_preconditionerType(t_preconditionerType)
+{
+    switch (m_preconditionerType) {
+    case PreconditionerType::Jacobi:
+        m_inverseDiagonal = t_matrix.inverseDiagonal;
+        break;
+    case PreconditionerType::IncompleteCholesky:
+        factorIncompleteCholesky(t_matrix);
+        break;
+    case PreconditionerType::Multigrid:
+        m_multigridSolver = std::make_unique<MultigridSolver>(t_matrix);
+        break;
+    default:
+        break;
+    }
+}
+
+void PCGSolver::factorIncompleteCholesky(const ConductanceMatrix& t_matrix)
+{
+    const uint64_t rowsSize = t_matrix.size();
+
+    // Lower triangle of the matrix with sorted and merged columns
+    m_factorOffsets.assign(rowsSize + 1, 0);
+    m_factorColumns.clear();
+    m_factorValues.clear();
+
+    std::vector<std::pair<uint64_t, Value>> rowEntries {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        rowEntries.clear();
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k) {
+            if (t_matrix.columnIndices[k] < row)
+                rowEntries.emplace_back(t_matrix.columnIndices[k], -t_matrix.conductances[k]);
+        }
+
+        std::sort(rowEntries.begin(), rowEntries.end());
+
+        for (const auto& [column, value] : rowEntries) {
+            if (m_factorColumns.size() > m_factorOffsets[row] && m_factorColumns.back() == column) {
+                m_factorValues.back() += value;
+            } else {
+                m_factorColumns.push_back(column);
+                m_factorValues.push_back(value);
+            }
+        }
+
+        m_factorOffsets[row + 1] = m_factorColumns.size();
+    }
+
+    // Row oriented factorization: L(i, k) = (A(i, k) - sum(L(i, j) * L(k, j), j < k)) / L(k, k)
+    m_factorDiagonal.resize(rowsSize);
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        Value sumOfSquares {};
+
+        for (uint64_t k = m_factorOffsets[row]; k < m_factorOffsets[row + 1]; ++k) {
+            uint64_t column = m_factorColumns[k];
+            uint64_t i = m_factorOffsets[row];
+            uint64_t j = m_factorOffsets[column];
+            Value sumOfProducts {};
+
+            while (i < k && j < m_factorOffsets[column + 1]) {
+                if (m_factorColumns[i] < m_factorColumns[j]) {
+                    ++i;
+                } else if (m_factorColumns[i] > m_factorColumns[j]) {
+                    ++j;
+                } else {
+                    sumOfProducts += m_factorValues[i++] * m_factorValues[j++];
+                }
+            }
+
+            m_factorValues[k] = (m_factorValues[k] - sumOfProducts) / m_factorDiagonal[column];
+            sumOfSquares += m_factorValues[k] * m_factorValues[k];
+        }
+
+        Value pivot = t_matrix.diagonal[row] - sumOfSquares;
+
+        // Falls back to the diagonal if the factorization breaks down
+        m_factorDiagonal[row] = pivot > 0 ? std::sqrt(pivot) : std::sqrt(t_matrix.diagonal[row]);
+    }
+}
+
+void PCGSolver::precondition(const std::vector<Value>& t_residual, std::vector<Value>& t_preconditioned,
+    MultigridWorkspace& t_workspace) const
+{
+    const uint64_t rowsSize = t_residual.size();
+
+    switch (m_preconditionerType) {
+    case PreconditionerType::Jacobi:
+        VectorKernels::multiplyElements(t_preconditioned.data(), t_residual.data(), m_inverseDiagonal.data(), rowsSize);
+        break;
+
+    case PreconditionerType::IncompleteCholesky:
+        // Forward substitution: L * y = r
+        for (uint64_t row {}; row < rowsSize; ++row) {
+            Value sum = t_residual[row];
+
+            for (uint64_t k = m_factorOffsets[row]; k < m_factorOffsets[row + 1]; ++k)
+                sum -= m_factorValues[k] * t_preconditioned[m_factorColumns[k]];
+
+            t_preconditioned[row] = sum / m_factorDiagonal[row];
+        }
+
+        // Backward substitution: L^T * z = y
+        for (uint64_t row = rowsSize; row-- > 0;) {
+            t_preconditioned[row] /= m_factorDiagonal[row];
+
+            for (uint64_t k = m_factorOffsets[row]; k < m_factorOffsets[row + 1]; ++k)
+                t_preconditioned[m_factorColumns[k]] -= m_factorValues[k] * t_preconditioned[row];
+        }
+        break;
+
+    case PreconditionerType::Multigrid:
+        m_multigridSolver->applyCycle(t_residual, t_preconditioned, t_workspace);
+        break;
+
+    default:
+        break;
+    }
+}
+
+const MultigridSolver* PCGSolver::getMultigridSolver() const
+{
+    return m_multigridSolver.get();
+}
+
+uint64_t PCGSolver::solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision,
+    const uint64_t& t_maxIterations, Value& t_residual) const
+{
+    const uint64_t rowsSize = t_matrix.size();
+    uint64_t totalIterations {};
+
+    // Work vectors are kept in the state, so trials of one container solve without allocations
+    auto& residual = t_state.workResiduals;
+    auto& preconditioned = t_state.workPreconditioned;
+    auto& direction = t_state.workDirections;
+    auto& product = t_state.workProducts;
+    auto& workspace = t_state.multigridWorkspace;
+
+    residual.resize(rowsSize);
+    preconditioned.resize(rowsSize);
+    direction.resize(rowsSize);
+    product.resize(rowsSize);
+
+    if (m_multigridSolver)
+        m_multigridSolver->prepareWorkspace(workspace);
+
+    Value rightHandSideNorm {};
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        Value rightHandSide = t_matrix.fixedCurrents[row] - t_state.currents[row];
+        rightHandSideNorm += rightHandSide * rightHandSide;
+    }
+
+    rightHandSideNorm = rightHandSideNorm > 0 ? std::sqrt(rightHandSideNorm) : 1.0;
+
+    t_matrix.residual(t_state, residual);
+    t_residual = std::sqrt(dot(residual, residual)) / rightHandSideNorm;
+
+    if (t_residual < t_precision)
+        return totalIterations;
+
+    precondition(residual, preconditioned, workspace);
+    direction = preconditioned;
+    Value residualDotPreconditioned = dot(residual, preconditioned);
+
+    for (; totalIterations < t_maxIterations;) {
+        t_matrix.multiply(direction, product);
+
+        Value alpha = residualDotPreconditioned / dot(direction, product);
+
+        VectorKernels::addScaled(t_state.values.data(), direction.data(), alpha, rowsSize);
+        VectorKernels::addScaled(residual.data(), product.data(), -alpha, rowsSize);
+
+        ++totalIterations;
+        t_residual = std::sqrt(dot(residual, residual)) / rightHandSideNorm;
+
+        if (t_residual < t_precision)
+            break;
+
+        precondition(residual, preconditioned, workspace);
+
+        Value nextResidualDotPreconditioned = dot(residual, preconditioned);
+        Value beta = nextResidualDotPreconditioned / residualDotPreconditioned;
+        residualDotPreconditioned = nextResidualDotPreconditioned;
+
+        VectorKernels::scaleAndAdd(direction.data(), preconditioned.data(), beta, rowsSize);
+    }
+
+    return totalIterations;
+}
@@ -1,28 +1,54 @@
 // STL Libs
 #include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <functional>
 #include <iomanip>
 #include <iostream>
-#include <set>
 
 // Project Libs
+#include "../include/binary_stream.h"
 #include "../include/current_source.h"
 #include "../include/node.h"
+#include "../include/node_ordering.h"
+#include "../include/node_table.h"
 #include "../include/pdn_container.h"
 #include "../include/resistor.h"
+#include "../include/vector_kernels.h"
 #include "../include/voltage_source.h"
 
 // Expected size of the token
 constexpr static uint8_t TOKEN_SIZE = 4;
+// Approximate size of one element line, used to size the node table before parsing
+constexpr static uint64_t ESTIMATED_LINE_SIZE = 48;
+// First bytes of the cache file: "PDNCACHE"
+constexpr static uint64_t CACHE_MAGIC = 0x45484341434e4450ULL;
+// Version of the cache layout, caches of other versions are rebuilt
+constexpr static uint32_t CACHE_VERSION = 1;
+// Flags of the node in the cache
+constexpr static uint8_t CACHE_VOLTAGE_NODE = 1;
+constexpr static uint8_t CACHE_ABEL_TO_CONNECT_VOLTAGE_SOURCE = 2;
+constexpr static uint8_t CACHE_ABEL_TO_CONNECT_CURRENT_SOURCE = 4;
+// Rows whose values fit the cache of one core (256 KB), reads of neighbors further away are counted as cache misses
+constexpr static uint64_t CACHE_WINDOW_ROWS = 32768;
+// Number of sweeps to average the time of one sweep over
+constexpr static uint64_t MEASURED_SWEEPS = 5;
+// Number of calls to average the time of one call of the vector kernel over
+constexpr static uint64_t MEASURED_KERNEL_CALLS = 20;
 
 /**
- * @brief Trim string from left and right by reference value
+ * @brief Trim string view from left and right by reference value
  *
- * @param s string to trim
+ * @param s string view to trim
  */
-static inline void trim(std::string& s)
+static inline void trim(std::string_view& s)
 {
-    s.erase(s.begin(), std::find_if(s.begin(), s.end(), [](int ch) { return !isspace(ch); }));
-    s.erase(std::find_if(s.rbegin(), s.rend(), [](int ch) { return !isspace(ch); }).base(), s.end());
+    while (!s.empty() && isspace(static_cast<unsigned char>(s.front())))
+        s.remove_prefix(1);
+
+    while (!s.empty() && isspace(static_cast<unsigned char>(s.back())))
+        s.remove_suffix(1);
 };
 
 /**
@@ -32,239 +58,514 @@ static inline void trim(std::string& s)
  * @return true character is element character
  * @return false character is not element character
  */
-static inline bool isElementLine(char& c)
+static inline bool isElementLine(const char& c)
 {
     return c == 'i' || c == 'I' || c == 'R' || c == 'r' || c == 'V' || c == 'v';
 }
 
-PDNContainer::PDNContainer(const std::string& t_fileName)
+/**
+ * @brief Splits line by spaces and tabs into tokens
+ *
+ * @param t_line line to split
+ * @param t_tokens tokens of the line, only first TOKEN_SIZE are stored
+ * @return uint64_t number of tokens in the line
+ */
+static inline uint64_t splitLine(std::string_view t_line, std::array<std::string_view, TOKEN_SIZE>& t_tokens)
 {
-    std::ifstream file(t_fileName);
+    uint64_t tokensSize {};
 
-    if (file.is_open()) {
-        std::cout << "Parsing file - " << t_fileName << "\n"
-                  << std::flush;
+    while (!t_line.empty()) {
+        uint64_t tokenEnd = t_line.find_first_of(" \t");
+        std::string_view token = t_line.substr(0, tokenEnd);
 
-        std::string line {};
-        uint64_t totalNodes {};
-        uint64_t totalResistors {};
-        uint64_t totalCurrentSources {};
-        uint64_t totalVoltageSources {};
+        if (tokensSize < TOKEN_SIZE)
+            t_tokens[tokensSize] = token;
 
-        while (std::getline(file, line)) {
-            trim(line);
+        ++tokensSize;
 
-            if (isElementLine(line[0])) {
-                m_file.push_back(line);
-            }
+        if (tokenEnd == std::string_view::npos)
+            break;
+
+        t_line.remove_prefix(tokenEnd);
+        t_line.remove_prefix(std::min(t_line.find_first_not_of(" \t"), t_line.size()));
+    }
+
+    return tokensSize;
+}
+
+/**
+ * @brief Parses value of the element without copying the token
+ *
+ * @param t_token token to parse
+ * @param t_line line of the token for the error message
+ * @return Value parsed value
+ */
+static inline Value parseValue(std::string_view t_token, const std::string_view& t_line)
+{
+    Value value {};
+
+    if (!t_token.empty() && t_token.front() == '+')
+        t_token.remove_prefix(1);
+
+    auto result = std::from_chars(t_token.data(), t_token.data() + t_token.size(), value);
+
+    if (result.ec != std::errc())
+        throw std::runtime_error(std::string("Invalid value: ") + std::string(t_line));
+
+    return value;
+}
+
+PDNContainer::PDNContainer(const std::string& t_fileName, const bool& t_isCached)
+{
+    m_file = std::make_unique<MappedFile>(t_fileName);
+
+    if (m_file->isOpen()) {
+        auto start = std::chrono::high_resolution_clock::now();
+
+        if (t_isCached) {
+            m_cacheFileName = t_fileName + ".cache";
+            m_sourceHash = m_file->hash();
+        }
+
+        if (t_isCached && readCache()) {
+            std::cout << "Reading cache - " << m_cacheFileName << "\n"
+                      << std::flush;
+        } else {
+            std::cout << "Parsing file - " << t_fileName << "\n"
+                      << std::flush;
+
+            resetWorkingGraph();
         }
 
-        resetWorkingGraph();
+        buildCandidatePools();
+
+        auto topology = std::make_shared<PDNTopology>();
+        topology->voltageSourceValue = m_voltageSourceValue;
+        topology->nodes = m_nodes;
+        topology->resistors = m_resistors;
+        topology->voltageSources = m_voltageSources;
+        m_topology = topology;
+
+        auto end = std::chrono::high_resolution_clock::now();
+
+        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+        Value megabytes = static_cast<Value>(m_file->size()) / (1024.0 * 1024.0);
+        Value nodesMemory = static_cast<Value>(m_nodes->memorySize());
+        Value resistorsMemory = static_cast<Value>(m_resistors->memorySize());
+        auto precision = std::cout.precision();
 
         std::cout << "\nFile information:\n\n"
                   << std::flush;
-        std::cout << "- Total lines: " << m_file.size() << "\n"
+        std::cout << "- Total lines: " << m_totalLines << "\n"
                   << std::flush;
-        std::cout << "- Total resistors: " << m_resistors.size() << "\n"
+        std::cout << "- Total resistors: " << m_resistors->size() << "\n"
                   << std::flush;
         std::cout << "- Total current sources: " << m_currentSources.size() << "\n"
                   << std::flush;
         std::cout << "- Total voltage sources: " << m_voltageSources.size() << "\n"
                   << std::flush;
-        std::cout << "- Total nodes: " << m_nodes.size() << "\n"
+        std::cout << "- Total nodes: " << m_nodes->size() << "\n"
                   << std::flush;
+        std::cout << "- File size: " << std::fixed << std::setprecision(2) << megabytes << " MB\n"
+                  << "- Time of parsing: " << duration << " ms\n"
+                  << "- Speed of parsing: " << megabytes / std::max<Value>(duration, 1) * 1000.0 << " MB/s\n"
+                  << "- Memory of nodes: " << nodesMemory / (1024.0 * 1024.0) << " MB, "
+                  << nodesMemory / std::max<uint64_t>(m_nodes->size(), 1) << " bytes per node\n"
+                  << "- Memory of resistors: " << resistorsMemory / (1024.0 * 1024.0) << " MB, "
+                  << resistorsMemory / std::max<uint64_t>(m_resistors->size(), 1) << " bytes per resistor\n"
+                  << std::defaultfloat << std::setprecision(precision) << std::flush;
     } else {
         std::cout << "Failed to open file - " << t_fileName << "\n"
                   << std::flush;
     }
-
-    file.close();
 };
 
-PDNContainer::~PDNContainer(){
-    fullyDisconnection();
-}
-
 // =================================================================
 // Utility methods
 
-NodeCoords PDNContainer::parseNodeName(const std::string& t_nodeName)
+NodeCoords PDNContainer::parseNodeName(const std::string_view& t_nodeName)
 {
     if (t_nodeName != "0") {
         NodeCoords coordinates {};
-        std::string numberStr {};
-        bool isNumber = false;
+        const char* position = t_nodeName.data();
+        const char* end = position + t_nodeName.size();
         uint16_t i {};
 
-        for (auto c = t_nodeName.begin(); c != t_nodeName.end(); ++c) {
-            if (std::isdigit(*c)) {
-                numberStr += *c;
-                isNumber = true;
-            } else {
-                if (isNumber) {
-                    if (i > 0)
-                        coordinates[i - 1] = std::stoul(numberStr);
+        // First number is the net, next ones are the layer and coordinates
+        while (position != end) {
+            if (std::isdigit(static_cast<unsigned char>(*position))) {
+                uint32_t number {};
+                position = std::from_chars(position, end, number).ptr;
 
-                    ++i;
-                    isNumber = false;
-                }
+                if (i > 0 && i <= coordinates.size())
+                    coordinates[i - 1] = number;
 
-                numberStr.clear();
+                ++i;
+            } else {
+                ++position;
             }
         }
 
-        if (isNumber && i > 0)
-            coordinates[i - 1] = std::stoul(numberStr);
-
         return coordinates;
     }
 
     return { 0, 0, 0 };
 }
 
-// =================================================================
-// PDN methods
+void PDNContainer::buildConductanceMatrix()
+{
+    auto matrixInstance = std::make_shared<ConductanceMatrix>();
+    auto& matrix = *matrixInstance;
+    const auto& nodes = *m_nodes;
+    const auto& resistors = *m_resistors;
+    matrix.nodeRows.resize(nodes.size(), NO_ROW);
+
+    for (size_t i {}; i < nodes.size(); ++i) {
+        if (!nodes.hasFlag(i, NodeStore::VOLTAGE_NODE))
+            matrix.rowNodes.push_back(i);
+    }
 
-void PDNContainer::fullyDisconnection()
+    // Only rows are reordered, node ids and so the order of the output are kept
+    if (m_orderingType != OrderingType::Netlist)
+        matrix.rowNodes = NodeOrdering::order(nodes, resistors, matrix.rowNodes, m_orderingType);
+
+    // Cells of lattices are the first rows, so values of every lattice are one dense array
+    std::shared_ptr<StencilGrid> stencilGrid {};
+
+    if (m_solverType == SolverType::Stencil) {
+        stencilGrid = std::make_shared<StencilGrid>();
+        matrix.rowNodes = stencilGrid->detect(nodes, matrix.rowNodes);
+    }
+
+    for (uint64_t row {}; row < matrix.rowNodes.size(); ++row)
+        matrix.nodeRows[matrix.rowNodes[row]] = row;
+
+    const uint64_t rowsSize = matrix.rowNodes.size();
+
+    matrix.diagonal.resize(rowsSize);
+    matrix.fixedCurrents.resize(rowsSize);
+    matrix.rowOffsets.resize(rowsSize + 1);
+
+    // Count off-diagonal entries of every row
+    for (uint64_t i {}; i < resistors.size(); ++i) {
+        uint64_t firstRow = matrix.nodeRows[resistors.firstNodes[i]];
+        uint64_t secondRow = matrix.nodeRows[resistors.secondNodes[i]];
+
+        if (firstRow == secondRow)
+            continue;
+
+        if (firstRow != NO_ROW && secondRow != NO_ROW) {
+            ++matrix.rowOffsets[firstRow + 1];
+            ++matrix.rowOffsets[secondRow + 1];
+        }
+    }
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        matrix.rowOffsets[row + 1] += matrix.rowOffsets[row];
+
+    matrix.columnIndices.resize(matrix.rowOffsets.back());
+    matrix.conductances.resize(matrix.rowOffsets.back());
+
+    // Fill entries in order of resistors, so rows keep the order of connected resistors
+    std::vector<uint64_t> rowFill(matrix.rowOffsets.begin(), matrix.rowOffsets.end() - 1);
+
+    for (uint64_t i {}; i < resistors.size(); ++i) {
+        uint64_t firstNode = resistors.firstNodes[i];
+        uint64_t secondNode = resistors.secondNodes[i];
+        uint64_t firstRow = matrix.nodeRows[firstNode];
+        uint64_t secondRow = matrix.nodeRows[secondNode];
+        Value conductance = 1.0 / resistors.values[i];
+
+        if (firstRow == secondRow)
+            continue;
+
+        if (firstRow != NO_ROW) {
+            matrix.diagonal[firstRow] += conductance;
+
+            if (secondRow != NO_ROW) {
+                matrix.columnIndices[rowFill[firstRow]] = secondRow;
+                matrix.conductances[rowFill[firstRow]++] = conductance;
+            } else {
+                matrix.fixedCurrents[firstRow] += conductance * nodes.values[secondNode];
+            }
+        }
+
+        if (secondRow != NO_ROW) {
+            matrix.diagonal[secondRow] += conductance;
+
+            if (firstRow != NO_ROW) {
+                matrix.columnIndices[rowFill[secondRow]] = firstRow;
+                matrix.conductances[rowFill[secondRow]++] = conductance;
+            } else {
+                matrix.fixedCurrents[secondRow] += conductance * nodes.values[firstNode];
+            }
+        }
+    }
+
+    matrix.inverseDiagonal.resize(rowsSize);
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        matrix.inverseDiagonal[row] = 1.0 / matrix.diagonal[row];
+
+    // Colors are built up front, the matrix is immutable once it is shared
+    matrix.buildColors();
+    matrix.buildSlices();
+
+    if (stencilGrid)
+        stencilGrid->build(matrix);
+
+    m_conductanceMatrix = matrixInstance;
+    m_stencilGrid = stencilGrid;
+    m_conductanceState = matrix.createState(m_voltageSourceValue);
+
+    m_pcgSolver.reset();
+    m_choleskySolver.reset();
+    m_multigridSolver.reset();
+    m_refinementSolver.reset();
+}
+
+Value PDNContainer::measureSweepTime() const
 {
-    for (auto& node : m_nodes) {
-        node->fullyDisconnection();
+    const auto& matrix = *m_conductanceMatrix;
+    ConductanceState state = matrix.createState(m_voltageSourceValue);
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (uint64_t i {}; i < MEASURED_SWEEPS; ++i) {
+        if (m_stencilGrid)
+            m_stencilGrid->step(matrix, state, 0);
+        else
+            matrix.stepGaussSeidel(state, 0);
     }
 
-    for (auto& resistor : m_resistors) {
-        resistor->fullyDisconnection();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    return std::chrono::duration<Value, std::milli>(end - start).count() / MEASURED_SWEEPS;
+}
+
+void PDNContainer::printMultigridInformation(const MultigridSolver& t_multigridSolver)
+{
+    std::cout << "\nMultigrid information:\n\n"
+              << "- Levels: " << t_multigridSolver.levelsSize() << "\n"
+              << "- Operator complexity: " << t_multigridSolver.operatorComplexity() << "\n"
+              << std::flush;
+}
+
+void PDNContainer::updateMatrixCurrents()
+{
+    const auto& matrix = *m_conductanceMatrix;
+    auto& state = m_conductanceState;
+    auto previousRows = std::move(state.currentRows);
+
+    state.currentRows.clear();
+    state.changedRows.clear();
+    state.previousCurrents.resize(matrix.size());
+
+    // Only rows with current sources before or after the change are touched
+    for (uint64_t row : previousRows) {
+        state.previousCurrents[row] = state.currents[row];
+        state.currents[row] = 0;
     }
 
-    for (auto& currentSource : m_currentSources) {
-        currentSource->fullyDisconnection();
+    for (const auto& currentSource : m_currentSources) {
+        uint64_t row = matrix.nodeRows[currentSource->connectedNode];
+
+        if (row != NO_ROW) {
+            state.currents[row] += currentSource->value;
+            state.currentRows.push_back(row);
+        }
+    }
+
+    std::sort(state.currentRows.begin(), state.currentRows.end());
+    state.currentRows.erase(std::unique(state.currentRows.begin(), state.currentRows.end()), state.currentRows.end());
+
+    for (uint64_t row : state.currentRows) {
+        if (state.currents[row] != state.previousCurrents[row])
+            state.changedRows.push_back(row);
+    }
+
+    for (uint64_t row : previousRows) {
+        if (state.currents[row] == 0 && state.previousCurrents[row] != 0)
+            state.changedRows.push_back(row);
+
+        state.previousCurrents[row] = 0;
+    }
+}
+
+void PDNContainer::updateNodeValues()
+{
+    const auto& matrix = *m_conductanceMatrix;
+
+    for (uint64_t row {}; row < matrix.size(); ++row)
+        m_nodes->values[matrix.rowNodes[row]] = m_conductanceState.values[row];
+}
+
+void PDNContainer::connectFakeCurrentSource(const uint64_t& t_nodeIndex, const Value& t_value)
+{
+    std::stringstream currentSourceName;
+    currentSourceName << "I" << m_currentSources.size() + 1;
+
+    auto currentSource = std::make_shared<CurrentSource>(m_nodes->getCoordinates(t_nodeIndex), t_value,
+        currentSourceName.str());
+    currentSource->connectedNode = t_nodeIndex;
+
+    m_nodes->setFlag(t_nodeIndex, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, false);
+    m_nodes->setFlag(t_nodeIndex, NodeStore::FAKED_BY_CURRENT_SOURCE, true);
+    m_currentSources.push_back(currentSource);
+    m_freeNodes.erase(t_nodeIndex);
+}
+
+void PDNContainer::moveCurrentSource(const uint64_t& t_currentSourceIndex, const uint64_t& t_nodeIndex)
+{
+    const auto& currentSource = m_currentSources.at(t_currentSourceIndex);
+
+    // Disconnect current source
+    m_nodes->setFlag(currentSource->connectedNode, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, true);
+    m_nodes->setFlag(currentSource->connectedNode, NodeStore::FAKED_BY_CURRENT_SOURCE, true);
+
+    // Connect current source
+    currentSource->connectedNode = t_nodeIndex;
+    currentSource->name += "_new";
+    currentSource->setNewCoords(m_nodes->getCoordinates(t_nodeIndex));
+
+    m_nodes->setFlag(t_nodeIndex, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, false);
+    m_nodes->setFlag(t_nodeIndex, NodeStore::FAKED_BY_CURRENT_SOURCE, true);
+    m_freeNodes.erase(t_nodeIndex);
+    m_originalCurrentSources.erase(t_currentSourceIndex);
+}
+
+void PDNContainer::buildCandidatePools()
+{
+    m_freeNodes.reset(m_nodes->size());
+    m_originalCurrentSources.reset(m_currentSources.size());
+
+    for (size_t i {}; i < m_nodes->size(); ++i) {
+        if (!m_nodes->hasFlag(i, NodeStore::FAKED_BY_CURRENT_SOURCE)
+            && m_nodes->hasFlag(i, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE))
+            m_freeNodes.insert(i);
     }
 
-    for (auto& voltageSource : m_voltageSources) {
-        voltageSource->fullyDisconnection();
+    for (size_t i {}; i < m_currentSources.size(); ++i) {
+        if (!m_nodes->hasFlag(m_currentSources[i]->connectedNode, NodeStore::FAKED_BY_CURRENT_SOURCE))
+            m_originalCurrentSources.insert(i);
     }
 
-    m_nodes.clear();
-    m_resistors.clear();
+    updateCurrentSourceValueRange();
+}
+
+void PDNContainer::updateCurrentSourceValueRange()
+{
+    m_maxCurrentSourceValue = 0;
+    m_minCurrentSourceValue = 0;
+
+    for (const auto& currentSource : m_currentSources) {
+        m_maxCurrentSourceValue = std::max(m_maxCurrentSourceValue, currentSource->value);
+        m_minCurrentSourceValue = std::min(m_minCurrentSourceValue, currentSource->value);
+    }
+}
+
+// =================================================================
+// PDN methods
+
+void PDNContainer::fullyDisconnection()
+{
+    // Resistors and voltage sources of the fork belong to the original pdn, so stores are replaced and not cleared
+    m_nodes = std::make_shared<NodeStore>();
+    m_resistors = std::make_shared<ResistorStore>();
     m_currentSources.clear();
     m_voltageSources.clear();
 }
 
 void PDNContainer::resetWorkingGraph()
 {
-    // Temp map for faster access to elements while connecting.
-    std::map<std::string, std::shared_ptr<Node>> nodes {};
-    std::map<std::string, std::shared_ptr<Resistor>> resistors {};
-    std::map<std::string, std::shared_ptr<VoltageSource>> voltageSources {};
-    std::map<std::string, std::shared_ptr<CurrentSource>> currentSources {};
+    // Temp table for faster access to nodes while connecting, every line has about one new node
+    std::array<std::string_view, TOKEN_SIZE> lineTokens {};
+    std::string_view file = m_file ? m_file->view() : std::string_view {};
+    NodeTable nodes(file.size() / ESTIMATED_LINE_SIZE);
+
+    m_nodes->reserve(file.size() / ESTIMATED_LINE_SIZE);
+    m_resistors->reserve(file.size() / ESTIMATED_LINE_SIZE);
 
     // Initialize random number generator
     std::random_device rng {};
     m_generator = std::mt19937(rng());
+    m_totalLines = 0;
 
-    for (auto& line : m_file) {
-        std::vector<std::string> lineTokens {};
-        std::istringstream tokenStream(line);
-        std::string lineToken {};
+    auto findNode = [&](const NodeCoords& t_nodeCoords) {
+        uint64_t index = nodes.insert(NodeTable::packKey(t_nodeCoords), m_nodes->size());
 
-        while (std::getline(tokenStream, lineToken, ' '))
-            lineTokens.push_back(lineToken);
+        if (index == m_nodes->size())
+            m_nodes->add(t_nodeCoords);
 
-        if (lineTokens.size() != TOKEN_SIZE)
-            throw std::runtime_error(std::string("Invalid line: ") + line);
+        return index;
+    };
 
-        NodeCoords firstNodeCoords = parseNodeName(lineTokens[1]);
-        NodeCoords secondNodeCoords = parseNodeName(lineTokens[2]);
-        Value value = std::stod(lineTokens[3]);
+    while (!file.empty()) {
+        uint64_t lineEnd = file.find('\n');
+        std::string_view line = file.substr(0, lineEnd);
+        file.remove_prefix(lineEnd == std::string_view::npos ? file.size() : lineEnd + 1);
 
-        switch (line[0]) {
-        case 'r':
-        case 'R': {
-            auto resistor = std::make_shared<Resistor>(firstNodeCoords, secondNodeCoords, value, lineTokens[0]);
+        trim(line);
 
-            m_resistors.push_back(resistor);
-            resistors[lineTokens[0]] = ResistorPtr(resistor);
+        if (line.empty() || !isElementLine(line[0]))
+            continue;
 
-            if (!nodes.count(lineTokens[1])) {
-                m_nodes.push_back(std::make_shared<Node>(firstNodeCoords, lineTokens[1]));
-                nodes[lineTokens[1]] = NodePtr(m_nodes.back());
-            }
+        ++m_totalLines;
 
-            if (!nodes.count(lineTokens[2])) {
-                m_nodes.push_back(std::make_shared<Node>(secondNodeCoords, lineTokens[2]));
-                nodes[lineTokens[2]] = NodePtr(m_nodes.back());
-            }
+        if (splitLine(line, lineTokens) != TOKEN_SIZE)
+            throw std::runtime_error(std::string("Invalid line: ") + std::string(line));
 
-            auto firstNode = nodes[lineTokens[1]];
-            auto secondNode = nodes[lineTokens[2]];
+        NodeCoords firstNodeCoords = parseNodeName(lineTokens[1]);
+        NodeCoords secondNodeCoords = parseNodeName(lineTokens[2]);
+        Value value = parseValue(lineTokens[3], line);
 
-            resistor->connectedNodes.push_back(nodes[lineTokens[1]]);
-            resistor->connectedNodes.push_back(nodes[lineTokens[2]]);
+        switch (line[0]) {
+        case 'r':
+        case 'R': {
+            uint64_t firstNode = findNode(firstNodeCoords);
+            uint64_t secondNode = findNode(secondNodeCoords);
 
-            firstNode->connectResistor(resistors[lineTokens[0]]);
-            secondNode->connectResistor(resistors[lineTokens[0]]);
+            m_resistors->add(firstNode, secondNode, value, lineTokens[0]);
 
             // IR-drop preparations
-            firstNode->neighborNodes.push_back(nodes[lineTokens[2]]);
-            firstNode->addInverseSumOfResistance(resistor->value);
-
             if (firstNodeCoords[0] == 1)
-                firstNode->isAbelToConnectCurrentSource = true;
+                m_nodes->setFlag(firstNode, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, true);
             else if (firstNodeCoords[0] == 9)
-                firstNode->isAbelToConnectVoltageSource = true;
-
-            secondNode->neighborNodes.push_back(nodes[lineTokens[1]]);
-            secondNode->addInverseSumOfResistance(resistor->value);
+                m_nodes->setFlag(firstNode, NodeStore::ABEL_TO_CONNECT_VOLTAGE_SOURCE, true);
 
             if (secondNodeCoords[0] == 1)
-                secondNode->isAbelToConnectCurrentSource = true;
+                m_nodes->setFlag(secondNode, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, true);
             else if (secondNodeCoords[0] == 9)
-                secondNode->isAbelToConnectVoltageSource = true;
+                m_nodes->setFlag(secondNode, NodeStore::ABEL_TO_CONNECT_VOLTAGE_SOURCE, true);
 
             break;
         }
 
         case 'i':
         case 'I': {
-            auto currentSource = std::make_shared<CurrentSource>(firstNodeCoords, value, lineTokens[0]);
-
+            auto currentSource = std::make_shared<CurrentSource>(firstNodeCoords, value, Name(lineTokens[0]));
             m_currentSources.push_back(currentSource);
-            currentSources[lineTokens[0]] = CurrentSourcePtr(currentSource);
-
-            if (!nodes.count(lineTokens[1])) {
-                m_nodes.push_back(std::make_shared<Node>(firstNodeCoords, lineTokens[1]));
-                nodes[lineTokens[1]] = NodePtr(m_nodes.back());
-            }
-            auto firstNode = nodes[lineTokens[1]];
 
-            currentSource->connectedNode = nodes[lineTokens[1]];
-            firstNode->connectCurrentSource(currentSources[lineTokens[0]]);
+            currentSource->connectedNode = findNode(firstNodeCoords);
 
             // IR-drop preparations
-            firstNode->isAbelToConnectCurrentSource = false;
+            m_nodes->setFlag(currentSource->connectedNode, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, false);
             break;
         }
 
         case 'v':
         case 'V': {
-            auto voltageSource = std::make_shared<VoltageSource>(firstNodeCoords, value, lineTokens[0]);
-
+            auto voltageSource = std::make_shared<VoltageSource>(firstNodeCoords, value, Name(lineTokens[0]));
             m_voltageSources.push_back(voltageSource);
-            voltageSources[lineTokens[0]] = VoltageSourcePtr(voltageSource);
-
-            if (!nodes.count(lineTokens[1])) {
-                m_nodes.push_back(std::make_shared<Node>(firstNodeCoords, lineTokens[1]));
-                nodes[lineTokens[1]] = NodePtr(m_nodes.back());
-            }
 
-            auto firstNode = nodes[lineTokens[1]];
+            uint64_t firstNode = findNode(firstNodeCoords);
 
-            voltageSource->connectedNode = nodes[lineTokens[1]];
-            firstNode->connectVoltageSource(voltageSources[lineTokens[0]]);
+            voltageSource->connectedNode = firstNode;
 
             // IR-drop preparations
-            firstNode->value += voltageSource->value;
-            firstNode->isAbelToConnectVoltageSource = false;
-            firstNode->isVoltageNode = true;
+            m_nodes->values[firstNode] += voltageSource->value;
+            m_nodes->setFlag(firstNode, NodeStore::ABEL_TO_CONNECT_VOLTAGE_SOURCE, false);
+            m_nodes->setFlag(firstNode, NodeStore::VOLTAGE_NODE, true);
 
             m_voltageSourceValue = voltageSource->value;
             break;
@@ -274,6 +575,324 @@ void PDNContainer::resetWorkingGraph()
             break;
         }
     }
+
+    m_nodes->shrinkToFit();
+    m_resistors->shrinkToFit();
+    buildConductanceMatrix();
+}
+
+bool PDNContainer::readCache()
+{
+    MappedFile cacheFile(m_cacheFileName);
+
+    if (!cacheFile.isOpen())
+        return false;
+
+    try {
+        BinaryReader reader(cacheFile.view());
+
+        if (reader.read<uint64_t>() != CACHE_MAGIC || reader.read<uint32_t>() != CACHE_VERSION
+            || reader.read<uint64_t>() != m_sourceHash || reader.read<uint64_t>() != m_file->size())
+            return false;
+
+        m_totalLines = reader.read<uint64_t>();
+        m_voltageSourceValue = reader.read<Value>();
+
+        auto nodeCoords = reader.readArray<uint32_t>();
+        auto nodeFlags = reader.readArray<uint8_t>();
+        auto nodeValues = reader.readArray<Value>();
+        auto realValues = reader.readArray<Value>();
+
+        if (nodeCoords.size() != 3 * nodeFlags.size() || nodeValues.size() != nodeFlags.size()
+            || (!realValues.empty() && realValues.size() != nodeFlags.size()))
+            throw std::runtime_error("Invalid cache nodes");
+
+        m_nodes->reserve(nodeFlags.size());
+
+        for (uint64_t i {}; i < nodeFlags.size(); ++i) {
+            uint64_t node = m_nodes->add({ nodeCoords[3 * i], nodeCoords[3 * i + 1], nodeCoords[3 * i + 2] });
+
+            m_nodes->setFlag(node, NodeStore::VOLTAGE_NODE, nodeFlags[i] & CACHE_VOLTAGE_NODE);
+            m_nodes->setFlag(node, NodeStore::ABEL_TO_CONNECT_VOLTAGE_SOURCE,
+                nodeFlags[i] & CACHE_ABEL_TO_CONNECT_VOLTAGE_SOURCE);
+            m_nodes->setFlag(node, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE,
+                nodeFlags[i] & CACHE_ABEL_TO_CONNECT_CURRENT_SOURCE);
+            m_nodes->values[node] = nodeValues[i];
+            m_nodes->realValues[node] = realValues.empty() ? Value {} : realValues[i];
+        }
+
+        auto getNode = [&](const uint64_t& t_index) {
+            if (t_index >= m_nodes->size())
+                throw std::runtime_error("Invalid cache node index");
+
+            return t_index;
+        };
+
+        // Resistors
+        auto resistorNodes = reader.readArray<uint64_t>();
+        auto resistorValues = reader.readArray<Value>();
+
+        if (resistorNodes.size() != 2 * resistorValues.size())
+            throw std::runtime_error("Invalid cache resistors");
+
+        m_resistors->reserve(resistorValues.size());
+
+        for (uint64_t i {}; i < resistorValues.size(); ++i)
+            m_resistors->add(getNode(resistorNodes[2 * i]), getNode(resistorNodes[2 * i + 1]), resistorValues[i],
+                reader.readString());
+
+        m_resistors->shrinkToFit();
+
+        // Current sources
+        auto currentSourceNodes = reader.readArray<uint64_t>();
+        auto currentSourceValues = reader.readArray<Value>();
+
+        if (currentSourceNodes.size() != currentSourceValues.size())
+            throw std::runtime_error("Invalid cache current sources");
+
+        m_currentSources.reserve(currentSourceValues.size());
+
+        for (uint64_t i {}; i < currentSourceValues.size(); ++i) {
+            uint64_t node = getNode(currentSourceNodes[i]);
+            auto currentSource = std::make_shared<CurrentSource>(m_nodes->getCoordinates(node), currentSourceValues[i],
+                Name(reader.readString()));
+
+            currentSource->connectedNode = node;
+
+            m_currentSources.push_back(currentSource);
+        }
+
+        // Voltage sources
+        auto voltageSourceNodes = reader.readArray<uint64_t>();
+        auto voltageSourceValues = reader.readArray<Value>();
+
+        if (voltageSourceNodes.size() != voltageSourceValues.size())
+            throw std::runtime_error("Invalid cache voltage sources");
+
+        m_voltageSources.reserve(voltageSourceValues.size());
+
+        for (uint64_t i {}; i < voltageSourceValues.size(); ++i) {
+            uint64_t node = getNode(voltageSourceNodes[i]);
+            auto voltageSource = std::make_shared<VoltageSource>(m_nodes->getCoordinates(node), voltageSourceValues[i],
+                Name(reader.readString()));
+
+            voltageSource->connectedNode = node;
+
+            m_voltageSources.push_back(voltageSource);
+        }
+
+        if (!reader.isEnd())
+            throw std::runtime_error("Invalid cache size");
+
+        m_isRealValuesCached = !realValues.empty();
+    } catch (std::runtime_error& e) {
+        std::cout << "Ignoring cache - " << m_cacheFileName << ": " << e.what() << "\n"
+                  << std::flush;
+
+        fullyDisconnection();
+        m_totalLines = 0;
+
+        return false;
+    }
+
+    buildConductanceMatrix();
+
+    return true;
+}
+
+void PDNContainer::writeCache()
+{
+    // Cache is written to a temporary file first, so other runs never read it half written
+    std::string temporaryFileName = m_cacheFileName + ".tmp";
+    BinaryWriter writer(temporaryFileName);
+
+    std::vector<uint32_t> nodeCoords {};
+    std::vector<uint8_t> nodeFlags {};
+    std::vector<Value> nodeValues {};
+
+    nodeCoords.reserve(3 * m_nodes->size());
+    nodeFlags.reserve(m_nodes->size());
+    nodeValues.reserve(m_nodes->size());
+
+    for (uint64_t i {}; i < m_nodes->size(); ++i) {
+        auto coordinates = m_nodes->getCoordinates(i);
+        bool isVoltageNode = m_nodes->hasFlag(i, NodeStore::VOLTAGE_NODE);
+        nodeCoords.insert(nodeCoords.end(), coordinates.begin(), coordinates.end());
+
+        nodeFlags.push_back((isVoltageNode ? CACHE_VOLTAGE_NODE : 0)
+            | (m_nodes->hasFlag(i, NodeStore::ABEL_TO_CONNECT_VOLTAGE_SOURCE) ? CACHE_ABEL_TO_CONNECT_VOLTAGE_SOURCE : 0)
+            | (m_nodes->hasFlag(i, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE) ? CACHE_ABEL_TO_CONNECT_CURRENT_SOURCE : 0));
+
+        // Initial value of the voltage node is the sum of its sources, other nodes start from zero
+        nodeValues.push_back(isVoltageNode ? m_nodes->values[i] : 0);
+    }
+
+    writer.write<uint64_t>(CACHE_MAGIC);
+    writer.write<uint32_t>(CACHE_VERSION);
+    writer.write<uint64_t>(m_sourceHash);
+    writer.write<uint64_t>(m_file->size());
+    writer.write<uint64_t>(m_totalLines);
+    writer.write<Value>(m_voltageSourceValue);
+    writer.writeArray(nodeCoords);
+    writer.writeArray(nodeFlags);
+    writer.writeArray(nodeValues);
+    writer.writeArray(m_nodes->realValues);
+
+    std::vector<uint64_t> elementNodes {};
+    std::vector<Value> elementValues {};
+
+    auto writeElements = [&](const auto& t_elements, auto t_getNodes) {
+        elementNodes.clear();
+        elementValues.clear();
+
+        for (const auto& element : t_elements) {
+            t_getNodes(element);
+            elementValues.push_back(element->value);
+        }
+
+        writer.writeArray(elementNodes);
+        writer.writeArray(elementValues);
+
+        for (const auto& element : t_elements)
+            writer.writeString(element->name);
+    };
+
+    // Resistors are stored field by field, so their arrays are written as they are
+    elementNodes.reserve(2 * m_resistors->size());
+
+    for (uint64_t i {}; i < m_resistors->size(); ++i) {
+        elementNodes.push_back(m_resistors->firstNodes[i]);
+        elementNodes.push_back(m_resistors->secondNodes[i]);
+    }
+
+    writer.writeArray(elementNodes);
+    writer.writeArray(m_resistors->values);
+
+    for (uint64_t i {}; i < m_resistors->size(); ++i)
+        writer.writeString(m_resistors->getName(i));
+
+    writeElements(m_currentSources, [&](const auto& t_currentSource) {
+        elementNodes.push_back(t_currentSource->connectedNode);
+    });
+    writeElements(m_voltageSources, [&](const auto& t_voltageSource) {
+        elementNodes.push_back(t_voltageSource->connectedNode);
+    });
+
+    std::error_code error {};
+
+    if (writer.close())
+        std::filesystem::rename(temporaryFileName, m_cacheFileName, error);
+
+    if (error || std::filesystem::exists(temporaryFileName)) {
+        std::filesystem::remove(temporaryFileName, error);
+        std::cout << "Failed to write cache - " << m_cacheFileName << "\n"
+                  << std::flush;
+    } else {
+        std::cout << "\nCache is written - " << m_cacheFileName << "\n"
+                  << std::flush;
+    }
+}
+
+std::unique_ptr<PDNContainer> PDNContainer::fork(const uint64_t& t_seed) const
+{
+    auto pdnContainer = std::make_unique<PDNContainer>();
+
+    pdnContainer->m_isFork = true;
+    pdnContainer->m_voltageSourceValue = m_voltageSourceValue;
+    pdnContainer->m_resistors = m_resistors;
+    pdnContainer->m_voltageSources = m_voltageSources;
+    pdnContainer->m_conductanceMatrix = m_conductanceMatrix;
+    pdnContainer->m_conductanceState = m_conductanceState;
+    pdnContainer->m_solverType = m_solverType;
+    pdnContainer->m_preconditionerType = m_preconditionerType;
+    pdnContainer->m_pcgSolver = m_pcgSolver;
+    pdnContainer->m_choleskySolver = m_choleskySolver;
+    pdnContainer->m_multigridSolver = m_multigridSolver;
+    pdnContainer->m_stencilGrid = m_stencilGrid;
+    pdnContainer->m_precisionType = m_precisionType;
+    pdnContainer->m_refinementSolver = m_refinementSolver;
+    pdnContainer->m_lastResidual = m_lastResidual;
+    pdnContainer->m_topology = m_topology;
+    pdnContainer->m_currentScale = m_currentScale;
+    pdnContainer->m_sensitivities = m_sensitivities;
+    pdnContainer->setSeed(t_seed);
+
+    // Connections between nodes are kept by the shared matrix, the copy of the node store holds only their fields and
+    // current sources keep ids of their nodes
+    pdnContainer->m_nodes = std::make_shared<NodeStore>(*m_nodes);
+    pdnContainer->m_currentSources.reserve(m_currentSources.size());
+
+    for (const auto& currentSource : m_currentSources)
+        pdnContainer->m_currentSources.push_back(std::make_shared<CurrentSource>(*currentSource));
+
+    pdnContainer->buildCandidatePools();
+
+    return pdnContainer;
+}
+
+PDNCheckpoint PDNContainer::createCheckpoint(const bool& t_isSolutionSaved) const
+{
+    PDNCheckpoint checkpoint {};
+
+    checkpoint.generator = m_generator;
+    checkpoint.currentScale = m_currentScale;
+    checkpoint.freeNodesMark = m_freeNodes.mark();
+    checkpoint.originalCurrentSourcesMark = m_originalCurrentSources.mark();
+    checkpoint.currentSources.reserve(m_currentSources.size());
+    checkpoint.nodeFlags.reserve(m_currentSources.size());
+
+    for (const auto& currentSource : m_currentSources) {
+        checkpoint.currentSources.push_back(*currentSource);
+        checkpoint.nodeFlags.push_back(m_nodes->flags[currentSource->connectedNode]);
+    }
+
+    if (t_isSolutionSaved)
+        checkpoint.values = m_conductanceState.values;
+
+    return checkpoint;
+}
+
+void PDNContainer::restoreCheckpoint(const PDNCheckpoint& t_checkpoint)
+{
+    // Nodes which got current sources after the checkpoint were taken from the pool of free nodes
+    for (const auto& currentSource : m_currentSources) {
+        m_nodes->setFlag(currentSource->connectedNode, NodeStore::ABEL_TO_CONNECT_CURRENT_SOURCE, true);
+        m_nodes->setFlag(currentSource->connectedNode, NodeStore::FAKED_BY_CURRENT_SOURCE, false);
+    }
+
+    // Placement keeps indexes of current sources and only appends new ones, so saved ones are restored in place
+    m_currentSources.resize(t_checkpoint.currentSources.size());
+
+    for (uint64_t i {}; i < t_checkpoint.currentSources.size(); ++i) {
+        auto& currentSource = m_currentSources[i];
+
+        if (currentSource)
+            *currentSource = t_checkpoint.currentSources[i];
+        else
+            currentSource = std::make_shared<CurrentSource>(t_checkpoint.currentSources[i]);
+
+        m_nodes->flags[currentSource->connectedNode] = t_checkpoint.nodeFlags[i];
+    }
+
+    m_freeNodes.rollback(t_checkpoint.freeNodesMark);
+    m_originalCurrentSources.rollback(t_checkpoint.originalCurrentSourcesMark);
+    m_generator = t_checkpoint.generator;
+    m_currentScale = t_checkpoint.currentScale;
+    updateCurrentSourceValueRange();
+
+    if (!t_checkpoint.values.empty()) {
+        m_conductanceState.values = t_checkpoint.values;
+
+        // Values changed everywhere, residuals of the local solver are recomputed on the next solve
+        m_conductanceState.isSolved = false;
+        updateNodeValues();
+    }
+}
+
+void PDNContainer::setSeed(const uint64_t& t_seed)
+{
+    std::seed_seq sequence { static_cast<uint32_t>(t_seed), static_cast<uint32_t>(t_seed >> 32) };
+    m_generator.seed(sequence);
 }
 
 // =================================================================
@@ -284,194 +903,523 @@ void PDNContainer::changeCurrentSourceValue(const Value& t_value)
     for (auto& currentSource : m_currentSources) {
         currentSource->value *= (1 + t_value);
     }
+
+    m_currentScale *= (1 + t_value);
+    updateCurrentSourceValueRange();
+}
+
+void PDNContainer::scaleIRDrop(const Value& t_difference)
+{
+    const auto& matrix = *m_conductanceMatrix;
+    const Value scale = 1 + t_difference;
+
+    changeCurrentSourceValue(scale / m_currentScale - 1);
+    m_currentScale = scale;
+    updateMatrixCurrents();
+
+    // Node ir-drop is linear in currents of the sources: V - v = scale * (V - v_real)
+    for (uint64_t row {}; row < matrix.size(); ++row) {
+        Value realValue = m_nodes->realValues[matrix.rowNodes[row]];
+        m_conductanceState.values[row] = m_voltageSourceValue - scale * (m_voltageSourceValue - realValue);
+    }
+
+    // Values changed everywhere, residuals of the local solver are recomputed on the next solve
+    m_conductanceState.isSolved = false;
+    updateNodeValues();
 }
 
 
 void PDNContainer::connectFakeCurrentSources(const Value& t_percentageConnect)
 {
-    std::vector<uint64_t> indexesToConnect {}; // Nodes indexes to connect current source
+    if (m_freeNodes.size() > 0) {
+        std::uniform_real_distribution<> distrValue(m_minCurrentSourceValue, m_maxCurrentSourceValue);
+        uint64_t totalToBeConnected = ceil(m_freeNodes.size() * t_percentageConnect);
 
-    for (size_t i {}; i < m_nodes.size(); ++i) {
-        if (!m_nodes[i]->isFakedByCurrentSource && m_nodes[i]->isAbelToConnectCurrentSource) {
-            indexesToConnect.push_back(i);
-        }
+        // Connected nodes leave the pool, so every picked node is new
+        for (size_t i {}; i < totalToBeConnected && m_freeNodes.size() > 0; ++i)
+            connectFakeCurrentSource(m_freeNodes.pick(m_generator), distrValue(m_generator));
+    } else {
+        changeCurrentSourceValue(t_percentageConnect);
     }
+}
 
-    if (indexesToConnect.size() > 0) {
-        Value maxCurrentSourceValue {};
-        Value minCurrentSourceValue {};
+void PDNContainer::inverseCurrentSourcesPositions(const Value& t_percentage)
+{
+    if (m_originalCurrentSources.size() > 0 && m_freeNodes.size() > 0) {
+        uint64_t totalToBeInverted = floor(m_originalCurrentSources.size() * t_percentage);
+
+        // Moved current sources and their new nodes leave the pools, so every pick is new
+        for (size_t i {}; i < totalToBeInverted && m_originalCurrentSources.size() > 0 && m_freeNodes.size() > 0; ++i) {
+            uint64_t disconnectIndex = m_originalCurrentSources.pick(m_generator);
+            uint64_t connectIndex = m_freeNodes.pick(m_generator);
 
-        for (auto& currentSource : m_currentSources) {
-            maxCurrentSourceValue = std::max(maxCurrentSourceValue, currentSource->value);
-            minCurrentSourceValue = std::min(minCurrentSourceValue, currentSource->value);
+            moveCurrentSource(disconnectIndex, connectIndex);
         }
+    } else {
+        connectFakeCurrentSources(t_percentage);
+    }
+}
 
-        std::uniform_int_distribution<std::mt19937::result_type> distrConnect(0, indexesToConnect.size() - 1);
-        std::set<uint64_t, std::greater<uint64_t>> randomIndexesToConnect {};
+void PDNContainer::connectGuidedCurrentSources(const Value& t_difference)
+{
+    if (m_sensitivities.size() != m_nodes->size())
+        throw std::runtime_error("Sensitivities of the pdn are not calculated");
+
+    if (m_freeNodes.size() > 0) {
+        std::uniform_real_distribution<> distrValue(m_minCurrentSourceValue, m_maxCurrentSourceValue);
+        Value predictedDifference {};
 
-        uint64_t totalToBeConnected = ceil(indexesToConnect.size() * t_percentageConnect);
+        // Random nodes are connected one by one until the predicted change is reached
+        while (predictedDifference < t_difference && m_freeNodes.size() > 0) {
+            uint64_t index = m_freeNodes.pick(m_generator);
+            Value value = distrValue(m_generator);
 
-        for (size_t i {}; i < totalToBeConnected; ++i) {
-            randomIndexesToConnect.insert(indexesToConnect.at(distrConnect(m_generator)));
+            connectFakeCurrentSource(index, value);
+            predictedDifference += value * m_sensitivities[index];
         }
+    } else {
+        // No free nodes, values of current sources are scaled to the predicted change instead
+        Value sensitivity {};
 
-        std::uniform_real_distribution<> distrValue(minCurrentSourceValue, maxCurrentSourceValue);
+        for (const auto& currentSource : m_currentSources)
+            sensitivity += currentSource->value * m_sensitivities[currentSource->connectedNode];
 
-        for (auto& index : randomIndexesToConnect) {
-            std::stringstream currentSourceName;
-            currentSourceName << "I" << m_currentSources.size() + 1;
+        if (sensitivity > 0)
+            changeCurrentSourceValue(t_difference / sensitivity);
+    }
+}
 
-            auto currentSource = std::make_shared<CurrentSource>(m_nodes.at(index)->getCoordinates(),
-                distrValue(m_generator), currentSourceName.str());
-            currentSource->connectedNode = m_nodes[index];
+// =================================================================
+// IR-drop methods
 
-            m_nodes[index]->connectCurrentSource(currentSource);
-            m_nodes[index]->isAbelToConnectCurrentSource = false;
-            m_nodes[index]->isFakedByCurrentSource = true;
-            m_currentSources.push_back(currentSource);
-        }
-    } else {
-        changeCurrentSourceValue(t_percentageConnect);
+void PDNContainer::setSolver(const std::string& t_solver, const std::string& t_preconditioner)
+{
+    SolverType solverType {};
+
+    if (t_solver == "gs")
+        solverType = SolverType::GaussSeidel;
+    else if (t_solver == "pcg")
+        solverType = SolverType::PCG;
+    else if (t_solver == "cholesky")
+        solverType = SolverType::Cholesky;
+    else if (t_solver == "amg")
+        solverType = SolverType::Multigrid;
+    else if (t_solver == "local")
+        solverType = SolverType::Local;
+    else if (t_solver == "stencil")
+        solverType = SolverType::Stencil;
+    else
+        throw std::invalid_argument(std::string("Unknown solver: ") + t_solver);
+
+    if (t_preconditioner == "jacobi")
+        m_preconditionerType = PreconditionerType::Jacobi;
+    else if (t_preconditioner == "ic")
+        m_preconditionerType = PreconditionerType::IncompleteCholesky;
+    else if (t_preconditioner == "amg")
+        m_preconditionerType = PreconditionerType::Multigrid;
+    else
+        throw std::invalid_argument(std::string("Unknown preconditioner: ") + t_preconditioner);
+
+    m_pcgSolver.reset();
+    m_choleskySolver.reset();
+    m_multigridSolver.reset();
+    m_refinementSolver.reset();
+
+    if ((solverType == SolverType::Stencil) == (m_solverType == SolverType::Stencil)) {
+        m_solverType = solverType;
+        return;
     }
+
+    Value sweepTimeBefore = measureSweepTime();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    m_solverType = solverType;
+    buildConductanceMatrix();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    if (!m_stencilGrid)
+        return;
+
+    const auto& matrix = *m_conductanceMatrix;
+    Value sweepTimeAfter = measureSweepTime();
+    auto precision = std::cout.precision();
+
+    std::cout << "\nStencil information:\n\n"
+              << "- Regions: " << m_stencilGrid->regions.size() << "\n"
+              << std::fixed << std::setprecision(2)
+              << "- Rows in regions: " << m_stencilGrid->stencilRowsSize << " ("
+              << 100.0 * m_stencilGrid->stencilRowsSize / std::max<uint64_t>(matrix.size(), 1) << "%)\n"
+              << "- Entries in stencils: " << m_stencilGrid->stencilEntriesSize() << " ("
+              << 100.0 * m_stencilGrid->stencilEntriesSize() / std::max<uint64_t>(matrix.rowOffsets.back(), 1) << "%)\n"
+              << "- Memory of stencils: " << m_stencilGrid->memorySize() / 1024.0 / 1024.0 << " MB\n"
+              << "- Time of building: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " ms\n"
+              << "- Time of sweep: " << sweepTimeBefore << " ms -> " << sweepTimeAfter << " ms\n"
+              << std::defaultfloat << std::setprecision(precision) << std::flush;
 }
 
-void PDNContainer::inverseCurrentSourcesPositions(const Value& t_percentage)
+void PDNContainer::setOrdering(const std::string& t_ordering)
 {
-    std::vector<uint64_t> indexesToDisconnect {}; // Current source indexes to disconnect
-    std::vector<uint64_t> indexesToConnect {}; // Nodes indexes to connect current source
+    OrderingType orderingType {};
+
+    if (t_ordering == "netlist")
+        orderingType = OrderingType::Netlist;
+    else if (t_ordering == "morton")
+        orderingType = OrderingType::Morton;
+    else if (t_ordering == "hilbert")
+        orderingType = OrderingType::Hilbert;
+    else if (t_ordering == "rcm")
+        orderingType = OrderingType::ReverseCuthillMcKee;
+    else
+        throw std::invalid_argument(std::string("Unknown ordering: ") + t_ordering);
+
+    if (orderingType == m_orderingType)
+        return;
+
+    auto localityBefore = m_conductanceMatrix->calculateLocality(CACHE_WINDOW_ROWS);
+    Value sweepTimeBefore = measureSweepTime();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    m_orderingType = orderingType;
+    buildConductanceMatrix();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto localityAfter = m_conductanceMatrix->calculateLocality(CACHE_WINDOW_ROWS);
+    Value sweepTimeAfter = measureSweepTime();
+    auto precision = std::cout.precision();
+
+    std::cout << "\nOrdering information:\n\n"
+              << "- Ordering: " << t_ordering << "\n"
+              << "- Time of ordering: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+              << " ms\n"
+              << std::fixed << std::setprecision(2)
+              << "- Mean distance to neighbor rows: " << localityBefore[0] << " -> " << localityAfter[0] << "\n"
+              << "- Neighbor reads out of cache: " << 100 * localityBefore[1] << "% -> " << 100 * localityAfter[1]
+              << "%\n"
+              << "- Time of sweep: " << sweepTimeBefore << " ms -> " << sweepTimeAfter << " ms\n"
+              << std::defaultfloat << std::setprecision(precision) << std::flush;
+}
 
-    for (size_t i {}; i < m_nodes.size(); ++i) {
-        if (!m_nodes[i]->isFakedByCurrentSource && m_nodes[i]->isAbelToConnectCurrentSource) {
-            indexesToConnect.push_back(i);
-        }
-    }
+void PDNContainer::setWorkingPrecision(const std::string& t_precision)
+{
+    if (t_precision == "double")
+        m_precisionType = PrecisionType::Double;
+    else if (t_precision == "float")
+        m_precisionType = PrecisionType::Float;
+    else
+        throw std::invalid_argument(std::string("Unknown working precision: ") + t_precision);
+
+    m_refinementSolver.reset();
+}
 
-    for (size_t i {}; i < m_currentSources.size(); ++i) {
-        if (!m_currentSources[i]->connectedNode->isFakedByCurrentSource) {
-            indexesToDisconnect.push_back(i);
+void PDNContainer::benchmarkKernels()
+{
+    const auto& matrix = *m_conductanceMatrix;
+    const auto& nodes = *m_nodes;
+    const uint64_t rowsSize = matrix.size();
+    const SimdType selectedSimdType = VectorKernels::getSimdType();
+    const SimdType supportedSimdType = VectorKernels::detectSimdType();
+
+    ConductanceState state = matrix.createState(m_voltageSourceValue);
+    std::vector<Value> product(rowsSize);
+    uint64_t totalCompared {};
+
+    // Kernels run on the arrays of the pdn, as they do in solves and in comparisons of fakes
+    std::vector<std::pair<std::string, std::function<void()>>> kernels {
+        { "Dot product", [&]() { VectorKernels::dot(state.values.data(), matrix.diagonal.data(), rowsSize); } },
+        { "Vector update",
+            [&]() { VectorKernels::addScaled(product.data(), matrix.inverseDiagonal.data(), 1e-3, rowsSize); } },
+        { "Matrix product",
+            [&]() { VectorKernels::multiply(matrix, state.values.data(), product.data()); } },
+        { "Multicolor sweep",
+            [&]() {
+                for (uint64_t color {}; color + 1 < matrix.sliceColorOffsets.size(); ++color) {
+                    VectorKernels::relaxSlices(matrix, state, matrix.sliceColorOffsets[color],
+                        matrix.sliceColorOffsets[color + 1], 0);
+                }
+            } },
+        { "IR-drop statistics",
+            [&]() {
+                VectorKernels::calculateIRDrop(nodes.values.data(), nodes.flags.data(), NodeStore::VOLTAGE_NODE,
+                    m_voltageSourceValue, nodes.size());
+            } },
+        { "IR-drop difference",
+            [&]() {
+                VectorKernels::sumRelativeDifferences(nodes.values.data(), nodes.realValues.data(), nodes.flags.data(),
+                    NodeStore::VOLTAGE_NODE, m_voltageSourceValue, nodes.size(), totalCompared);
+            } },
+    };
+
+    if (m_stencilGrid)
+        kernels.insert(kernels.begin() + 4, { "Stencil sweep", [&]() { m_stencilGrid->step(matrix, state, 0); } });
+
+    auto precision = std::cout.precision();
+
+    std::cout << "\nKernel information:\n\n"
+              << "- SIMD: " << VectorKernels::getSimdName(selectedSimdType) << "\n"
+              << std::fixed << std::setprecision(3);
+
+    for (auto& [name, kernel] : kernels) {
+        Value scalarTime {};
+
+        std::cout << "- " << name << ":";
+
+        for (int simd {}; simd <= static_cast<int>(supportedSimdType); ++simd) {
+            VectorKernels::setSimdType(static_cast<SimdType>(simd));
+            kernel();
+
+            auto start = std::chrono::high_resolution_clock::now();
+
+            for (uint64_t i {}; i < MEASURED_KERNEL_CALLS; ++i)
+                kernel();
+
+            auto end = std::chrono::high_resolution_clock::now();
+            Value time = std::chrono::duration<Value, std::milli>(end - start).count() / MEASURED_KERNEL_CALLS;
+
+            if (simd == 0)
+                scalarTime = time;
+
+            std::cout << (simd == 0 ? " " : " -- ") << VectorKernels::getSimdName(static_cast<SimdType>(simd)) << " "
+                      << time << " ms";
+
+            if (simd != 0)
+                std::cout << " (" << std::setprecision(2) << scalarTime / time << "x)" << std::setprecision(3);
         }
+
+        std::cout << "\n";
     }
 
-    if (indexesToDisconnect.size() > 0 && indexesToConnect.size() > 0) {
-        std::uniform_int_distribution<std::mt19937::result_type> distrDisconnect(0, indexesToDisconnect.size() - 1);
-        std::uniform_int_distribution<std::mt19937::result_type> distrConnect(0, indexesToConnect.size() - 1);
+    std::cout << std::defaultfloat << std::setprecision(precision) << std::flush;
 
-        std::set<uint64_t, std::greater<uint64_t>> randomIndexesToDisconnect {};
-        std::set<uint64_t, std::greater<uint64_t>> randomIndexesToConnect {};
+    VectorKernels::setSimdType(selectedSimdType);
+}
+
+void PDNContainer::setThreads(const uint64_t& t_threads)
+{
+    if (t_threads == 0)
+        throw std::invalid_argument("Number of threads must be positive");
 
-        uint64_t totalToBeInverted = floor(indexesToDisconnect.size() * t_percentage);
+    m_threadPool = t_threads > 1 ? std::make_shared<ThreadPool>(t_threads) : nullptr;
+}
 
-        for (size_t i {}; i < totalToBeInverted; ++i) {
-            randomIndexesToDisconnect.insert(indexesToDisconnect.at(distrDisconnect(m_generator)));
-            randomIndexesToConnect.insert(indexesToConnect.at(distrConnect(m_generator)));
+Value PDNContainer::getLastResidual()
+{
+    return m_lastResidual;
+}
+
+uint64_t PDNContainer::solveState(ConductanceState& t_state, const Value& t_precision, const uint64_t& t_maxIterations)
+{
+    uint64_t totalIterations {};
+    const auto& matrix = *m_conductanceMatrix;
+    auto rowsSize = matrix.size();
+
+    switch (m_solverType) {
+    case SolverType::GaussSeidel:
+        if (m_precisionType == PrecisionType::Float && !m_threadPool) {
+            if (!m_refinementSolver) {
+                m_refinementSolver = std::make_shared<RefinementSolver<float>>(matrix);
+
+                Value matrixMemory = static_cast<Value>((matrix.inverseDiagonal.size() + matrix.conductances.size())
+                        * sizeof(Value)
+                    + (matrix.rowOffsets.size() + matrix.columnIndices.size()) * sizeof(uint64_t));
+                auto precision = std::cout.precision();
+
+                std::cout << "\nRefinement information:\n\n"
+                          << "- Working precision: float\n"
+                          << std::fixed << std::setprecision(2)
+                          << "- Memory of swept matrix: " << matrixMemory / (1024.0 * 1024.0) << " MB -> "
+                          << m_refinementSolver->memorySize() / (1024.0 * 1024.0) << " MB\n"
+                          << std::defaultfloat << std::setprecision(precision) << std::flush;
+            }
+
+            totalIterations = m_refinementSolver->solve(matrix, t_state, t_precision, t_maxIterations);
+        } else if (m_threadPool) {
+            for (; totalIterations < t_maxIterations; ++totalIterations) {
+                if (matrix.stepMulticolorGaussSeidel(t_state, t_precision, *m_threadPool) == rowsSize)
+                    break;
+            }
+        } else {
+            for (; totalIterations < t_maxIterations; ++totalIterations) {
+                if (matrix.stepGaussSeidel(t_state, t_precision) == rowsSize)
+                    break;
+            }
         }
+        break;
+
+    case SolverType::PCG:
+        if (!m_pcgSolver) {
+            m_pcgSolver = std::make_shared<PCGSolver>(matrix, m_preconditionerType);
 
-        auto itDisconnect = randomIndexesToDisconnect.begin();
-        auto itConnect = randomIndexesToConnect.begin();
+            if (m_pcgSolver->getMultigridSolver())
+                printMultigridInformation(*m_pcgSolver->getMultigridSolver());
+        }
 
-        for (size_t i {}; i < totalToBeInverted; ++i) {
-            // Save current source value
-            uint64_t disconnectIndex = *itDisconnect;
+        totalIterations = m_pcgSolver->solve(matrix, t_state, t_precision, t_maxIterations, m_lastResidual);
+        break;
 
-            // Disconnect current source
-            auto node = m_currentSources[disconnectIndex]->connectedNode;
-            node->disconnectCurrentSource(m_currentSources.at(disconnectIndex));
-            node->isAbelToConnectCurrentSource = true;
-            node->isFakedByCurrentSource = true;
+    case SolverType::Cholesky:
+        if (!m_choleskySolver) {
+            auto start = std::chrono::high_resolution_clock::now();
+            m_choleskySolver = std::make_shared<CholeskySolver>(matrix);
+            auto end = std::chrono::high_resolution_clock::now();
 
-            // Connect current source
-            uint64_t connectIndex = *itConnect;
-            m_currentSources[disconnectIndex]->connectedNode = m_nodes[connectIndex];
-            m_currentSources[disconnectIndex]->name += "_new";
-            m_currentSources[disconnectIndex]->setNewCoords(m_nodes[connectIndex]->getCoordinates());
+            std::cout << "\nFactorization information:\n\n"
+                      << "- Factor non zeros: " << m_choleskySolver->factorSize() << "\n"
+                      << "- Time of factorization: "
+                      << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count() << " ms\n"
+                      << std::flush;
+        }
 
-            m_nodes[connectIndex]->connectCurrentSource(m_currentSources[disconnectIndex]);
-            m_nodes[connectIndex]->isAbelToConnectCurrentSource = false;
-            m_nodes[connectIndex]->isFakedByCurrentSource = true;
+        totalIterations = m_choleskySolver->solve(matrix, t_state, m_lastResidual);
+        break;
 
-            ++itDisconnect;
-            ++itConnect;
+    case SolverType::Stencil:
+        for (; totalIterations < t_maxIterations; ++totalIterations) {
+            if (m_stencilGrid->step(matrix, t_state, t_precision) == rowsSize)
+                break;
         }
-    } else {
-        connectFakeCurrentSources(t_percentage);
+        break;
+
+    case SolverType::Local:
+        totalIterations = matrix.relaxLocal(t_state, t_precision, t_maxIterations * rowsSize);
+        break;
+
+    case SolverType::Multigrid:
+        if (!m_multigridSolver) {
+            m_multigridSolver = std::make_shared<MultigridSolver>(matrix);
+            printMultigridInformation(*m_multigridSolver);
+        }
+
+        totalIterations = m_multigridSolver->solve(matrix, t_state, t_precision, t_maxIterations, m_lastResidual);
+        break;
+
+    default:
+        break;
     }
-}
 
-// =================================================================
-// IR-drop methods
+    return totalIterations;
+}
 
 uint64_t PDNContainer::solveDC(const Value& t_precision, const uint64_t& t_maxIterations)
 {
-    uint64_t totalIterations {};
-    auto nodesSize = m_nodes.size();
+    updateMatrixCurrents();
 
-    for (auto& node : m_nodes) {
-        node->reinitializationDC();
+    uint64_t totalIterations = solveState(m_conductanceState, t_precision, t_maxIterations);
+
+    m_conductanceState.isSolved = true;
+    updateNodeValues();
+
+    return totalIterations;
+}
+
+uint64_t PDNContainer::verifyIRDrop(const Value& t_precision, const uint64_t& t_maxIterations, Value& t_error)
+{
+    std::vector<Value> expectedValues = m_nodes->values;
+
+    uint64_t totalIterations = solveDC(t_precision, t_maxIterations);
+    const auto& values = m_nodes->values;
+    Value maxIRDrop {};
+    Value maxDifference {};
+
+    for (uint64_t i {}; i < values.size(); ++i) {
+        maxIRDrop = std::max(maxIRDrop, m_voltageSourceValue - values[i]);
+        maxDifference = std::max(maxDifference, std::fabs(expectedValues[i] - values[i]));
     }
 
-    for (; totalIterations < t_maxIterations; ++totalIterations) {
-        uint64_t totalNodesSolved {};
+    t_error = maxIRDrop > 0 ? maxDifference / maxIRDrop : maxDifference;
 
-        for (auto& node : m_nodes) {
-            totalNodesSolved += node->stepDC(t_precision);
-        }
+    return totalIterations;
+}
 
-        if (totalNodesSolved == nodesSize)
-            break;
+uint64_t PDNContainer::calculateSensitivities(const Value& t_precision, const uint64_t& t_maxIterations)
+{
+    const auto& matrix = *m_conductanceMatrix;
+    uint64_t totalIterations {};
+    uint64_t totalNodes {};
+    Value maxCurrentSourceValue {};
+    Value maxWeight {};
+    std::vector<Value> weights(matrix.size());
+
+    for (uint64_t i {}; i < m_nodes->size(); ++i) {
+        if (!m_nodes->hasFlag(i, NodeStore::VOLTAGE_NODE))
+            ++totalNodes;
+    }
+
+    for (const auto& currentSource : m_currentSources)
+        maxCurrentSourceValue = std::max(maxCurrentSourceValue, std::fabs(currentSource->value));
+
+    m_sensitivities.assign(m_nodes->size(), 0);
+
+    // Mean difference is sum(|r - v| / (V - r)) / n, changes of values are linear in currents and by the triangle
+    // inequality its change is at most sum(|dv| / (V - r)) / n. The inverse of the matrix is non negative, so a current
+    // changes values of all rows in one direction and the bound is the adjoint solution with the weights 1 / (V - r) / n.
+    for (uint64_t row {}; row < matrix.size(); ++row) {
+        Value realIRDrop = m_voltageSourceValue - m_nodes->realValues[matrix.rowNodes[row]];
+
+        if (realIRDrop > 0) {
+            weights[row] = 1 / realIRDrop;
+            maxWeight = std::max(maxWeight, weights[row]);
+        }
     }
 
+    if (totalNodes == 0 || maxWeight == 0)
+        return totalIterations;
+
+    // Weights are scaled to the currents of the pdn, so the solution is of the same order as the ir-drop and the
+    // precision of the solver means the same. Rows solve fixedCurrents - currents, so the weights are moved there.
+    Value scale = (maxCurrentSourceValue > 0 ? maxCurrentSourceValue : 1) / maxWeight;
+    ConductanceState state = matrix.createState(0);
+
+    for (uint64_t row {}; row < matrix.size(); ++row)
+        state.currents[row] = matrix.fixedCurrents[row] - scale * weights[row];
+
+    totalIterations += solveState(state, t_precision, t_maxIterations);
+
+    for (uint64_t row {}; row < matrix.size(); ++row)
+        m_sensitivities[matrix.rowNodes[row]] = state.values[row] / scale / totalNodes;
+
     return totalIterations;
 }
 
 void PDNContainer::solveDCAndSaveRealValues(const Value& t_precision, const uint64_t& t_maxIterations)
 {
-    for (auto& node : m_nodes) {
-        node->initializationDC();
-    }
+    const auto& matrix = *m_conductanceMatrix;
+
+    // Cached real values are the initial guess, so every solver still reaches the requested precision
+    for (uint64_t row {}; row < matrix.size(); ++row)
+        m_conductanceState.values[row] = m_isRealValuesCached ? m_nodes->realValues[matrix.rowNodes[row]] : m_voltageSourceValue;
+
+    m_conductanceState.isSolved = false;
 
     solveDC(t_precision, t_maxIterations);
 
-    for (auto& node : m_nodes) {
-        node->realValue = node->value;
-    }
+    m_nodes->realValues = m_nodes->values;
+
+    if (!m_cacheFileName.empty() && !m_isRealValuesCached)
+        writeCache();
 }
 
 Value PDNContainer::compareFakeWithRealValues()
 {
-    std::vector<Value> percentageDifference {};
-    Value meanDifference {};
+    const auto& nodes = *m_nodes;
+    uint64_t totalCompared {};
 
-    for (auto& node : m_nodes) {
-        if (!node->isVoltageNode) {
-            percentageDifference.push_back(
-                std::fabs((node->realValue - node->value) / (m_voltageSourceValue - node->realValue)));
-        }
-    }
-
-    for (auto& difference : percentageDifference) {
-        meanDifference += difference;
-    }
+    Value meanDifference = VectorKernels::sumRelativeDifferences(nodes.values.data(), nodes.realValues.data(),
+        nodes.flags.data(), NodeStore::VOLTAGE_NODE, m_voltageSourceValue, nodes.size(), totalCompared);
 
-    meanDifference /= percentageDifference.size();
+    meanDifference /= totalCompared;
 
     return meanDifference;
 }
 
 std::array<Value, 3> PDNContainer::calculateIRDrop()
 {
-    std::array<Value, 3> irDropValues { 0, m_voltageSourceValue, 0 };
+    const auto& nodes = *m_nodes;
 
-    for (auto& node : m_nodes) {
-        if (!node->isVoltageNode) {
-            Value tmp = m_voltageSourceValue - node->value;
+    std::array<Value, 3> irDropValues = VectorKernels::calculateIRDrop(nodes.values.data(), nodes.flags.data(),
+        NodeStore::VOLTAGE_NODE, m_voltageSourceValue, nodes.size());
 
-            irDropValues[0] = std::max(irDropValues[0], tmp);
-            irDropValues[1] = std::min(irDropValues[1], tmp);
-            irDropValues[2] += tmp;
-        }
-    }
-
-    irDropValues[2] /= m_nodes.size();
+    irDropValues[2] /= nodes.size();
 
     return irDropValues;
 }
@@ -479,38 +1427,40 @@ std::array<Value, 3> PDNContainer::calculateIRDrop()
 // =================================================================
 // Write/save methods
 
-void PDNContainer::writeIRDropToFile(const std::string& t_fileName)
+std::unique_ptr<PDNSnapshot> PDNContainer::createSnapshot(const std::string& t_netlistFileName,
+    const std::string& t_irDropFileName, const std::string& t_baseNetlistInclude) const
 {
-    std::ofstream file(t_fileName);
+    auto snapshot = std::make_unique<PDNSnapshot>();
 
-    if (file.is_open()) {
-        file << "Nodes, Values\n"
-             << std::flush;
+    snapshot->topology = m_topology;
+    snapshot->netlistFileName = t_netlistFileName;
+    snapshot->irDropFileName = t_irDropFileName;
+    snapshot->baseNetlistInclude = t_baseNetlistInclude;
+    snapshot->currentSources.reserve(m_currentSources.size());
+    snapshot->nodeValues = m_nodes->values;
 
-        for (const auto& nodeInstance : m_nodes)
-            file << nodeInstance->name << ", " << std::setprecision(16) << std::scientific << m_voltageSourceValue - nodeInstance->value << "\n";
+    for (const auto& currentSource : m_currentSources)
+        snapshot->currentSources.push_back(*currentSource);
 
-        file.close();
-    }
+    return snapshot;
 }
 
-void PDNContainer::writeNetlistToFile(const std::string& t_fileName)
+uint64_t PDNContainer::writeIRDropToFile(const std::string& t_fileName)
 {
-    std::ofstream file(t_fileName);
-
-    if (file.is_open()) {
-        for (const auto& resistorInstance : m_resistors)
-            file << resistorInstance->name << " " << resistorInstance->toString() << "\n"
-                 << std::flush;
+    return createSnapshot({}, t_fileName)->writeIRDrop(m_writer);
+}
 
-        for (const auto& voltageSourceInstance : m_voltageSources)
-            file << voltageSourceInstance->name << " " << voltageSourceInstance->toString() << "\n"
-                 << std::flush;
+uint64_t PDNContainer::writeNetlistToFile(const std::string& t_fileName)
+{
+    return createSnapshot(t_fileName, {})->writeNetlist(m_writer);
+}
 
-        for (const auto& currentSourceInstance : m_currentSources)
-            file << currentSourceInstance->name << " " << currentSourceInstance->toString() << "\n"
-                 << std::flush;
+std::shared_ptr<const PDNTopology> PDNContainer::getTopology() const
+{
+    return m_topology;
+}
 
-        file.close();
-    }
-}
\ No newline at end of file
+uint64_t PDNContainer::writeBaseNetlistToFile(const std::string& t_fileName)
+{
+    return m_topology->writeBaseNetlist(m_writer, t_fileName);
+}
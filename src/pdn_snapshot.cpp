@@ -0,0 +1,87 @@
+// Project Libs
+#include "../include/buffered_writer.h"
+#include "../include/node.h"
+#include "../include/pdn_snapshot.h"
+#include "../include/resistor.h"
+#include "../include/voltage_source.h"
+
+/**
+ * @brief Writes line description of the element in spice format.
+ *
+ * @param t_writer writer to write with.
+ * @param t_name name of the element.
+ * @param t_element element to write.
+ */
+template <typename T>
+static inline void writeElement(BufferedWriter& t_writer, const std::string_view& t_name, const T& t_element)
+{
+    t_writer.write(t_name);
+    t_writer.write(' ');
+    t_element.write(t_writer);
+    t_writer.write('\n');
+}
+
+uint64_t PDNTopology::writeBaseNetlist(BufferedWriter& t_writer, const std::string& t_fileName) const
+{
+    if (!t_writer.open(t_fileName))
+        return 0;
+
+    for (uint64_t i {}; i < resistors->size(); ++i)
+        writeElement(t_writer, resistors->getName(i), Resistor(*resistors, *nodes, i));
+
+    for (const auto& voltageSource : voltageSources)
+        writeElement(t_writer, voltageSource->name, *voltageSource);
+
+    return t_writer.close();
+}
+
+uint64_t PDNSnapshot::memorySize() const
+{
+    uint64_t size = sizeof(PDNSnapshot) + nodeValues.capacity() * sizeof(Value) + baseNetlistInclude.capacity()
+        + mapsFolderName.capacity();
+
+    for (const auto& currentSource : currentSources)
+        size += sizeof(CurrentSource) + currentSource.name.capacity();
+
+    return size;
+}
+
+uint64_t PDNSnapshot::writeNetlist(BufferedWriter& t_writer) const
+{
+    if (!t_writer.open(netlistFileName))
+        return 0;
+
+    if (baseNetlistInclude.empty()) {
+        for (uint64_t i {}; i < topology->resistors->size(); ++i)
+            writeElement(t_writer, topology->resistors->getName(i), Resistor(*topology->resistors, *topology->nodes, i));
+
+        for (const auto& voltageSource : topology->voltageSources)
+            writeElement(t_writer, voltageSource->name, *voltageSource);
+    } else {
+        t_writer.write(std::string_view(".include "));
+        t_writer.write(baseNetlistInclude);
+        t_writer.write('\n');
+    }
+
+    for (const auto& currentSource : currentSources)
+        writeElement(t_writer, currentSource.name, currentSource);
+
+    return t_writer.close();
+}
+
+uint64_t PDNSnapshot::writeIRDrop(BufferedWriter& t_writer) const
+{
+    if (!t_writer.open(irDropFileName))
+        return 0;
+
+    t_writer.write(std::string_view("Nodes, Values\n"));
+
+    for (uint64_t i {}; i < nodeValues.size(); ++i) {
+        Node(*topology->nodes, i).writeName(t_writer);
+        t_writer.write(std::string_view(", "));
+        t_writer.writeScientific(topology->voltageSourceValue - nodeValues[i], 16);
+        t_writer.write('\n');
+    }
+
+    return t_writer.close();
+}
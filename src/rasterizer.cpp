@@ -0,0 +1,201 @@
+// STL Libs
+#include <algorithm>
+#include <array>
+
+// Project Libs
+#include "../include/binary_stream.h"
+#include "../include/current_source.h"
+#include "../include/node.h"
+#include "../include/rasterizer.h"
+#include "../include/resistor.h"
+
+// Layer index of layers without nodes
+constexpr static uint32_t NO_LAYER = std::numeric_limits<uint32_t>::max();
+// Size of the .npy header including its magic, version and length, data starts aligned to it
+constexpr static uint64_t NPY_ALIGNMENT = 64;
+
+/**
+ * @brief Checks if the coordinates are the ones of the ground node.
+ *
+ * @param t_nodeCoords metal layer and coordinates of the node.
+ * @return true - node is the ground.
+ * @return false - node is on a metal layer.
+ */
+static inline bool isGround(const NodeCoords& t_nodeCoords)
+{
+    return t_nodeCoords[0] == 0 && t_nodeCoords[1] == 0 && t_nodeCoords[2] == 0;
+}
+
+Rasterizer::Rasterizer(const PDNTopology& t_topology, const uint32_t& t_binSize, const uint64_t& t_threads)
+    : m_binSize(std::max<uint32_t>(t_binSize, 1))
+    , m_threadPool(std::make_unique<ThreadPool>(std::max<uint64_t>(t_threads, 1)))
+{
+    std::vector<NodeCoords> nodeCoords {};
+    std::array<uint32_t, 256> layerIndexes {};
+    uint32_t maxX {};
+    uint32_t maxY {};
+
+    const auto& nodes = *t_topology.nodes;
+    const auto& resistors = *t_topology.resistors;
+
+    nodeCoords.reserve(nodes.size());
+    layerIndexes.fill(NO_LAYER);
+    m_minX = std::numeric_limits<uint32_t>::max();
+    m_minY = std::numeric_limits<uint32_t>::max();
+
+    for (uint64_t i {}; i < nodes.size(); ++i) {
+        nodeCoords.push_back(nodes.getCoordinates(i));
+        const auto& coords = nodeCoords.back();
+
+        if (isGround(coords))
+            continue;
+
+        layerIndexes[static_cast<L>(coords[0])] = 0;
+        m_minX = std::min(m_minX, coords[1]);
+        m_minY = std::min(m_minY, coords[2]);
+        maxX = std::max(maxX, coords[1]);
+        maxY = std::max(maxY, coords[2]);
+    }
+
+    for (uint32_t layer {}; layer < layerIndexes.size(); ++layer) {
+        if (layerIndexes[layer] != NO_LAYER) {
+            layerIndexes[layer] = m_layers.size();
+            m_layers.push_back(layer);
+        }
+    }
+
+    if (m_layers.empty())
+        return;
+
+    m_width = (maxX - m_minX) / m_binSize + 1;
+    m_height = (maxY - m_minY) / m_binSize + 1;
+
+    // Nodes are grouped by layer, so every layer is rasterized by one thread
+    m_layerNodeOffsets.assign(m_layers.size() + 1, 0);
+    m_nodeCells.resize(nodeCoords.size());
+
+    for (uint64_t i {}; i < nodeCoords.size(); ++i) {
+        m_nodeCells[i] = findCell(nodeCoords[i]);
+
+        if (m_nodeCells[i] != NO_CELL)
+            ++m_layerNodeOffsets[layerIndexes[nodeCoords[i][0]] + 1];
+    }
+
+    for (uint64_t layer {}; layer < m_layers.size(); ++layer)
+        m_layerNodeOffsets[layer + 1] += m_layerNodeOffsets[layer];
+
+    std::vector<uint64_t> nextNode(m_layerNodeOffsets.begin(), m_layerNodeOffsets.end() - 1);
+    m_layerNodes.resize(m_layerNodeOffsets.back());
+
+    for (uint64_t i {}; i < nodeCoords.size(); ++i) {
+        if (m_nodeCells[i] != NO_CELL)
+            m_layerNodes[nextNode[layerIndexes[nodeCoords[i][0]]]++] = i;
+    }
+
+    m_resistanceMap.assign(m_layers.size() * m_width * m_height, 0);
+
+    for (uint64_t i {}; i < resistors.size(); ++i) {
+        Resistor resistor(resistors, nodes, i);
+
+        for (const auto& coords : resistor.getCoordinates()) {
+            uint64_t cell = findCell(coords);
+
+            if (cell != NO_CELL)
+                m_resistanceMap[cell] += static_cast<float>(resistor.value() / 2);
+        }
+    }
+}
+
+uint64_t Rasterizer::width() const
+{
+    return m_width;
+}
+
+uint64_t Rasterizer::height() const
+{
+    return m_height;
+}
+
+const std::vector<uint32_t>& Rasterizer::getLayers() const
+{
+    return m_layers;
+}
+
+uint64_t Rasterizer::writeResistanceMaps(const std::string& t_folderName)
+{
+    return writeMaps(m_resistanceMap, t_folderName, "resistance-map");
+}
+
+uint64_t Rasterizer::writeFakeMaps(const PDNSnapshot& t_snapshot, const std::string& t_folderName)
+{
+    const uint64_t mapSize = m_width * m_height;
+    std::vector<float> irDropMap(m_layers.size() * mapSize);
+    std::vector<float> currentMap(m_layers.size() * mapSize);
+
+    {
+        // Threads of the pool rasterize one fake at a time
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        m_threadPool->parallelFor(0, m_layers.size(), [&](uint64_t t_begin, uint64_t t_end, uint64_t) {
+            for (uint64_t k = m_layerNodeOffsets[t_begin]; k < m_layerNodeOffsets[t_end]; ++k) {
+                uint64_t node = m_layerNodes[k];
+                float irDrop = static_cast<float>(t_snapshot.topology->voltageSourceValue - t_snapshot.nodeValues[node]);
+                float& cellValue = irDropMap[m_nodeCells[node]];
+
+                cellValue = std::max(cellValue, irDrop);
+            }
+        });
+    }
+
+    for (const auto& currentSource : t_snapshot.currentSources) {
+        uint64_t cell = findCell(currentSource.getCoordinates());
+
+        if (cell != NO_CELL)
+            currentMap[cell] += static_cast<float>(currentSource.value);
+    }
+
+    return writeMaps(irDropMap, t_folderName, "ir-drop-map") + writeMaps(currentMap, t_folderName, "current-map");
+}
+
+uint64_t Rasterizer::findCell(const NodeCoords& t_nodeCoords) const
+{
+    if (isGround(t_nodeCoords) || t_nodeCoords[1] < m_minX || t_nodeCoords[2] < m_minY)
+        return NO_CELL;
+
+    auto layer = std::lower_bound(m_layers.begin(), m_layers.end(), t_nodeCoords[0]);
+    uint64_t x = (t_nodeCoords[1] - m_minX) / m_binSize;
+    uint64_t y = (t_nodeCoords[2] - m_minY) / m_binSize;
+
+    if (layer == m_layers.end() || *layer != t_nodeCoords[0] || x >= m_width || y >= m_height)
+        return NO_CELL;
+
+    return (static_cast<uint64_t>(layer - m_layers.begin()) * m_height + y) * m_width + x;
+}
+
+uint64_t Rasterizer::writeMaps(const std::vector<float>& t_maps, const std::string& t_folderName,
+    const std::string& t_name)
+{
+    const uint64_t mapSize = m_width * m_height;
+    uint64_t totalSize {};
+
+    // Header of .npy format version 1.0, padded with spaces so the data is aligned
+    std::string header = "{'descr': '<f4', 'fortran_order': False, 'shape': (" + std::to_string(m_height) + ", "
+        + std::to_string(m_width) + "), }";
+    uint64_t headerSize = 10 + header.size() + 1;
+    header.append((NPY_ALIGNMENT - headerSize % NPY_ALIGNMENT) % NPY_ALIGNMENT, ' ');
+    header.push_back('\n');
+
+    for (uint64_t layer {}; layer < m_layers.size(); ++layer) {
+        BinaryWriter writer(t_folderName + "/" + t_name + "-m" + std::to_string(m_layers[layer]) + ".npy");
+
+        writer.writeValues("\x93NUMPY\x01\x00", 8);
+        writer.write<uint16_t>(header.size());
+        writer.writeValues(header.data(), header.size());
+        writer.writeValues(t_maps.data() + layer * mapSize, mapSize);
+
+        if (writer.close())
+            totalSize += writer.size();
+    }
+
+    return totalSize;
+}
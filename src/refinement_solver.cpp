@@ -0,0 +1,104 @@
+// STL Libs
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Project Libs
+#include "../include/refinement_solver.h"
+
+template <typename T>
+RefinementSolver<T>::RefinementSolver(const ConductanceMatrix& t_matrix)
+{
+    const uint64_t rowsSize = t_matrix.size();
+
+    if (std::max(rowsSize, t_matrix.rowOffsets.back()) > UINT32_MAX)
+        throw std::runtime_error("Conductance matrix is too large for 32-bit indices");
+
+    m_inverseDiagonal.resize(rowsSize);
+    m_rowOffsets.resize(rowsSize + 1);
+    m_columnIndices.resize(t_matrix.columnIndices.size());
+    m_conductances.resize(t_matrix.conductances.size());
+
+    for (uint64_t row {}; row < rowsSize; ++row)
+        m_inverseDiagonal[row] = static_cast<T>(t_matrix.inverseDiagonal[row]);
+
+    for (uint64_t row {}; row <= rowsSize; ++row)
+        m_rowOffsets[row] = static_cast<uint32_t>(t_matrix.rowOffsets[row]);
+
+    for (uint64_t k {}; k < t_matrix.columnIndices.size(); ++k) {
+        m_columnIndices[k] = static_cast<uint32_t>(t_matrix.columnIndices[k]);
+        m_conductances[k] = static_cast<T>(t_matrix.conductances[k]);
+    }
+}
+
+template <typename T>
+uint64_t RefinementSolver<T>::solve(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+    const Value& t_precision, const uint64_t& t_maxIterations) const
+{
+    const uint64_t rowsSize = t_matrix.size();
+    const T precision = static_cast<T>(t_precision);
+    uint64_t totalIterations {};
+
+    std::vector<Value> residual(rowsSize);
+    std::vector<T> residuals(rowsSize);
+    std::vector<T> corrections(rowsSize);
+
+    while (totalIterations < t_maxIterations) {
+        t_matrix.residual(t_state, residual);
+
+        for (uint64_t row {}; row < rowsSize; ++row)
+            residuals[row] = static_cast<T>(residual[row]);
+
+        std::fill(corrections.begin(), corrections.end(), T {});
+
+        uint64_t totalSweeps {};
+        bool isSolved {};
+
+        while (!isSolved && totalIterations < t_maxIterations) {
+            isSolved = sweep(residuals, corrections, precision) == rowsSize;
+            ++totalSweeps;
+            ++totalIterations;
+        }
+
+        for (uint64_t row {}; row < rowsSize; ++row)
+            t_state.values[row] += corrections[row];
+
+        if (isSolved && totalSweeps == 1)
+            break;
+    }
+
+    return totalIterations;
+}
+
+template <typename T>
+uint64_t RefinementSolver<T>::sweep(const std::vector<T>& t_residuals, std::vector<T>& t_corrections,
+    const T& t_precision) const
+{
+    uint64_t totalRowsSolved {};
+    const uint64_t rowsSize = m_inverseDiagonal.size();
+
+    for (uint64_t row {}; row < rowsSize; ++row) {
+        T sumOfNodes = t_residuals[row];
+
+        for (uint32_t k = m_rowOffsets[row]; k < m_rowOffsets[row + 1]; ++k)
+            sumOfNodes += m_conductances[k] * t_corrections[m_columnIndices[k]];
+
+        T previousCorrection = t_corrections[row];
+        t_corrections[row] = sumOfNodes * m_inverseDiagonal[row];
+
+        if (std::fabs(t_corrections[row] - previousCorrection) < t_precision)
+            ++totalRowsSolved;
+    }
+
+    return totalRowsSolved;
+}
+
+template <typename T>
+uint64_t RefinementSolver<T>::memorySize() const
+{
+    return (m_inverseDiagonal.capacity() + m_conductances.capacity()) * sizeof(T)
+        + (m_rowOffsets.capacity() + m_columnIndices.capacity()) * sizeof(uint32_t);
+}
+
+// Working precisions selectable at run time, sweeps in double run over the conductance matrix itself
+template class RefinementSolver<float>;
@@ -3,34 +3,103 @@
 #include <sstream>
 
 // Project libs
+#include "../include/buffered_writer.h"
+#include "../include/node.h"
 #include "../include/resistor.h"
 
-Resistor::Resistor(const NodeCoords& t_firstNode, const NodeCoords& t_secondNode, const Value& t_value,
-    const Name& t_name)
-    : m_layer({ (uint8_t)t_firstNode[0], (uint8_t)t_secondNode[0] })
-    , m_x({ t_firstNode[1], t_secondNode[1] })
-    , m_y({ t_firstNode[2], t_secondNode[2] })
-    , value(t_value)
-    , name(t_name) {};
+Resistor::Resistor(const ResistorStore& t_store, const NodeStore& t_nodes, const uint64_t& t_id)
+    : m_store(&t_store)
+    , m_nodes(&t_nodes)
+    , m_id(t_id) {};
 
-std::string Resistor::toString()
+std::string_view Resistor::name() const
 {
+    return m_store->getName(m_id);
+}
+
+Value Resistor::value() const
+{
+    return m_store->values[m_id];
+}
+
+std::array<uint64_t, 2> Resistor::getNodes() const
+{
+    return { m_store->firstNodes[m_id], m_store->secondNodes[m_id] };
+}
+
+std::array<NodeCoords, 2> Resistor::getCoordinates() const
+{
+    return { m_nodes->getCoordinates(m_store->firstNodes[m_id]), m_nodes->getCoordinates(m_store->secondNodes[m_id]) };
+}
+
+std::string Resistor::toString() const
+{
+    auto coordinates = getCoordinates();
     std::stringstream withoutNameDescription;
-    withoutNameDescription << "n1_m" << (uint32_t)(m_layer[0]) << "_" << m_x[0] << "_" << m_y[0] << " "
-                           << "n1_m" << (uint32_t)(m_layer[1]) << "_" << m_x[1] << "_" << m_y[1] << " " << std::fixed
-                           << std::setprecision(9) << value;
+    withoutNameDescription << "n1_m" << coordinates[0][0] << "_" << coordinates[0][1] << "_" << coordinates[0][2] << " "
+                           << "n1_m" << coordinates[1][0] << "_" << coordinates[1][1] << "_" << coordinates[1][2] << " "
+                           << std::fixed << std::setprecision(9) << value();
 
     return withoutNameDescription.str();
 }
 
-bool Resistor::isViaResistor()
+void Resistor::write(BufferedWriter& t_writer) const
+{
+    auto coordinates = getCoordinates();
+
+    t_writer.writeNodeName(coordinates[0]);
+    t_writer.write(' ');
+    t_writer.writeNodeName(coordinates[1]);
+    t_writer.write(' ');
+    t_writer.writeFixed(value(), 9);
+}
+
+bool Resistor::isViaResistor() const
 {
-    if (m_layer[0] != m_layer[1])
-        return true;
-    return false;
+    return m_nodes->layers[m_store->firstNodes[m_id]] != m_nodes->layers[m_store->secondNodes[m_id]];
 }
 
-void Resistor::fullyDisconnection()
+uint64_t ResistorStore::size() const
 {
-    connectedNodes.clear();
-};
\ No newline at end of file
+    return values.size();
+}
+
+void ResistorStore::reserve(const uint64_t& t_size)
+{
+    firstNodes.reserve(t_size);
+    secondNodes.reserve(t_size);
+    values.reserve(t_size);
+    m_nameOffsets.reserve(t_size + 1);
+}
+
+void ResistorStore::shrinkToFit()
+{
+    firstNodes.shrink_to_fit();
+    secondNodes.shrink_to_fit();
+    values.shrink_to_fit();
+    m_names.shrink_to_fit();
+    m_nameOffsets.shrink_to_fit();
+}
+
+uint64_t ResistorStore::add(const uint64_t& t_firstNode, const uint64_t& t_secondNode, const Value& t_value,
+    const std::string_view& t_name)
+{
+    firstNodes.push_back(t_firstNode);
+    secondNodes.push_back(t_secondNode);
+    values.push_back(t_value);
+    m_names.append(t_name);
+    m_nameOffsets.push_back(m_names.size());
+
+    return values.size() - 1;
+}
+
+std::string_view ResistorStore::getName(const uint64_t& t_id) const
+{
+    return std::string_view(m_names).substr(m_nameOffsets[t_id], m_nameOffsets[t_id + 1] - m_nameOffsets[t_id]);
+}
+
+uint64_t ResistorStore::memorySize() const
+{
+    return sizeof(ResistorStore) + firstNodes.capacity() * sizeof(uint64_t) + secondNodes.capacity() * sizeof(uint64_t)
+        + values.capacity() * sizeof(Value) + m_names.capacity() + m_nameOffsets.capacity() * sizeof(uint64_t);
+}
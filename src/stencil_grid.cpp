@@ -0,0 +1,209 @@
+// STL Libs
+#include <algorithm>
+
+// Project Libs
+#include "../include/stencil_grid.h"
+#include "../include/vector_kernels.h"
+
+// Min number of cells of the lattice, smaller lattices stay in sparse form
+constexpr static uint64_t MIN_REGION_CELLS = 64;
+
+std::vector<uint64_t> StencilGrid::detect(const NodeStore& t_nodes, const std::vector<uint64_t>& t_rowNodes)
+{
+    regions.clear();
+    stencilRowsSize = 0;
+
+    // Layer, y, x and id of every node, nodes of one line are together in order of x
+    std::vector<std::array<uint64_t, 4>> keys {};
+    keys.reserve(t_rowNodes.size());
+
+    for (uint64_t node : t_rowNodes)
+        keys.push_back({ t_nodes.layers[node], t_nodes.ys[node], t_nodes.xs[node], node });
+
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<uint64_t> orderedNodes {};
+    std::vector<uint8_t> isInRegion(t_nodes.size());
+    orderedNodes.reserve(t_rowNodes.size());
+
+    auto addRegion = [&](const uint64_t& t_begin, const uint64_t& t_width, const uint64_t& t_height) {
+        if (t_width * t_height < MIN_REGION_CELLS)
+            return;
+
+        StencilRegion region {};
+        region.layer = static_cast<L>(keys[t_begin][0]);
+        region.firstRow = orderedNodes.size();
+        region.width = t_width;
+        region.height = t_height;
+
+        for (uint64_t i = t_begin; i < t_begin + t_width * t_height; ++i) {
+            orderedNodes.push_back(keys[i][3]);
+            isInRegion[keys[i][3]] = true;
+        }
+
+        stencilRowsSize += t_width * t_height;
+        regions.push_back(std::move(region));
+    };
+
+    auto isSameLine = [&](const uint64_t& t_first, const uint64_t& t_second, const uint64_t& t_width) {
+        if (keys[t_first][0] != keys[t_second][0])
+            return false;
+
+        for (uint64_t i {}; i < t_width; ++i) {
+            if (keys[t_first + i][2] != keys[t_second + i][2])
+                return false;
+        }
+
+        return true;
+    };
+
+    // Consecutive lines of one layer with the same xs are one lattice
+    uint64_t regionBegin {};
+    uint64_t regionWidth {};
+    uint64_t regionHeight {};
+
+    for (uint64_t lineBegin {}; lineBegin < keys.size();) {
+        uint64_t lineEnd = lineBegin + 1;
+
+        while (lineEnd < keys.size() && keys[lineEnd][0] == keys[lineBegin][0] && keys[lineEnd][1] == keys[lineBegin][1])
+            ++lineEnd;
+
+        if (regionHeight > 0 && lineEnd - lineBegin == regionWidth
+            && isSameLine(lineBegin - regionWidth, lineBegin, regionWidth)) {
+            ++regionHeight;
+        } else {
+            addRegion(regionBegin, regionWidth, regionHeight);
+            regionBegin = lineBegin;
+            regionWidth = lineEnd - lineBegin;
+            regionHeight = 1;
+        }
+
+        lineBegin = lineEnd;
+    }
+
+    addRegion(regionBegin, regionWidth, regionHeight);
+
+    for (uint64_t node : t_rowNodes) {
+        if (!isInRegion[node])
+            orderedNodes.push_back(node);
+    }
+
+    return orderedNodes;
+}
+
+void StencilGrid::build(const ConductanceMatrix& t_matrix)
+{
+    for (auto& region : regions) {
+        const uint64_t width = region.width;
+        const uint64_t cellsSize = width * region.height;
+
+        region.eastConductances.assign(cellsSize, 0);
+        region.northConductances.assign(cellsSize, 0);
+        region.extraOffsets.assign(cellsSize + 1, 0);
+        region.extraColumns.clear();
+        region.extraConductances.clear();
+
+        for (uint64_t cell {}; cell < cellsSize; ++cell) {
+            const uint64_t row = region.firstRow + cell;
+            const uint64_t x = cell % width;
+
+            // West and south entries are the east and north ones of neighbors
+            for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k) {
+                uint64_t column = t_matrix.columnIndices[k];
+                Value conductance = t_matrix.conductances[k];
+
+                if (column == row + 1 && x + 1 < width) {
+                    region.eastConductances[cell] += conductance;
+                } else if (column == row + width && cell + width < cellsSize) {
+                    region.northConductances[cell] += conductance;
+                } else if ((column + 1 != row || x == 0) && (column + width != row || cell < width)) {
+                    region.extraColumns.push_back(column);
+                    region.extraConductances.push_back(conductance);
+                }
+            }
+
+            region.extraOffsets[cell + 1] = region.extraColumns.size();
+        }
+
+        for (auto* conductances : { &region.eastConductances, &region.northConductances }) {
+            if (std::all_of(conductances->begin(), conductances->end(), [](const Value& t_conductance) {
+                    return t_conductance == 0;
+                }))
+                *conductances = {};
+        }
+    }
+}
+
+uint64_t StencilGrid::step(const ConductanceMatrix& t_matrix, ConductanceState& t_state, const Value& t_precision) const
+{
+    uint64_t totalRowsSolved {};
+    const auto& values = t_state.values;
+    const auto& currents = t_state.currents;
+    auto& couplings = t_state.couplings;
+
+    for (const auto& region : regions) {
+        const uint64_t width = region.width;
+        couplings.resize(width * region.height);
+
+        // Rows out of the lattice keep their values while the line is relaxed, so their part is summed once
+        auto updateCouplings = [&](const uint64_t& t_y) {
+            for (uint64_t cell = t_y * width; cell < (t_y + 1) * width; ++cell) {
+                const uint64_t row = region.firstRow + cell;
+                Value coupling = t_matrix.fixedCurrents[row] - currents[row];
+
+                for (uint64_t k = region.extraOffsets[cell]; k < region.extraOffsets[cell + 1]; ++k)
+                    coupling += region.extraConductances[k] * values[region.extraColumns[k]];
+
+                couplings[cell] = coupling;
+            }
+        };
+
+        updateCouplings(0);
+
+        for (uint64_t y {}; y <= region.height; ++y) {
+            // Couplings are summed a line ahead, so vector loads do not wait for their scalar stores
+            if (y + 1 < region.height)
+                updateCouplings(y + 1);
+
+            if (y < region.height)
+                totalRowsSolved += VectorKernels::relaxStencilLine(region, t_matrix, t_state, couplings.data(), y, 0,
+                    t_precision);
+
+            // Red neighbors of black cells of the previous line are all relaxed now
+            if (y > 0)
+                totalRowsSolved += VectorKernels::relaxStencilLine(region, t_matrix, t_state, couplings.data(), y - 1,
+                    1, t_precision);
+        }
+    }
+
+    return totalRowsSolved + t_matrix.stepGaussSeidel(t_state, t_precision, stencilRowsSize);
+}
+
+uint64_t StencilGrid::stencilEntriesSize() const
+{
+    uint64_t totalEntries {};
+
+    for (const auto& region : regions) {
+        // Every conductance of the stencil is an entry of both rows it connects
+        for (const auto* conductances : { &region.eastConductances, &region.northConductances }) {
+            totalEntries += 2 * std::count_if(conductances->begin(), conductances->end(),
+                [](const Value& t_conductance) { return t_conductance != 0; });
+        }
+    }
+
+    return totalEntries;
+}
+
+uint64_t StencilGrid::memorySize() const
+{
+    uint64_t totalBytes = sizeof(StencilGrid) + regions.capacity() * sizeof(StencilRegion);
+
+    for (const auto& region : regions) {
+        totalBytes += (region.eastConductances.capacity() + region.northConductances.capacity()
+                          + region.extraConductances.capacity())
+                * sizeof(Value)
+            + (region.extraOffsets.capacity() + region.extraColumns.capacity()) * sizeof(uint64_t);
+    }
+
+    return totalBytes;
+}
@@ -0,0 +1,94 @@
+// STL Libs
+#include <algorithm>
+
+// Project Libs
+#include "../include/thread_pool.h"
+
+ThreadPool::ThreadPool(const uint64_t& t_size)
+{
+    for (uint64_t i = 1; i < t_size; ++i)
+        m_threads.emplace_back(&ThreadPool::workerLoop, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_startCondition.notify_all();
+
+    for (auto& thread : m_threads)
+        thread.join();
+}
+
+uint64_t ThreadPool::size() const
+{
+    return m_threads.size() + 1;
+}
+
+void ThreadPool::parallelFor(const uint64_t& t_begin, const uint64_t& t_end,
+    const std::function<void(uint64_t, uint64_t, uint64_t)>& t_function)
+{
+    const uint64_t threadsSize = size();
+    const uint64_t rangeSize = t_end > t_begin ? t_end - t_begin : 0;
+    const uint64_t chunkSize = (rangeSize + threadsSize - 1) / threadsSize;
+
+    auto task = [&](uint64_t t_threadIndex) {
+        uint64_t chunkBegin = std::min(t_end, t_begin + t_threadIndex * chunkSize);
+        uint64_t chunkEnd = std::min(t_end, chunkBegin + chunkSize);
+
+        if (chunkBegin < chunkEnd)
+            t_function(chunkBegin, chunkEnd, t_threadIndex);
+    };
+
+    if (threadsSize == 1 || rangeSize < threadsSize) {
+        if (rangeSize > 0)
+            t_function(t_begin, t_end, 0);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = task;
+        m_pendingThreads = m_threads.size();
+        ++m_generation;
+    }
+
+    m_startCondition.notify_all();
+    task(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_pendingThreads == 0; });
+    m_task = nullptr;
+}
+
+void ThreadPool::workerLoop(const uint64_t t_threadIndex)
+{
+    uint64_t generation {};
+
+    while (true) {
+        std::function<void(uint64_t)> task {};
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCondition.wait(lock, [&] { return m_isStopping || m_generation != generation; });
+
+            if (m_isStopping)
+                return;
+
+            generation = m_generation;
+            task = m_task;
+        }
+
+        task(t_threadIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+
+            if (--m_pendingThreads == 0)
+                m_doneCondition.notify_one();
+        }
+    }
+}
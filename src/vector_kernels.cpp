@@ -0,0 +1,991 @@
+// STL Libs
+#include <algorithm>
+#include <bitset>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define __VECTOR_KERNELS_X86__
+#include <immintrin.h>
+#endif
+
+#if defined(__VECTOR_KERNELS_X86__) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// Project Libs
+#include "../include/vector_kernels.h"
+
+// Vector versions are compiled for their instruction sets without changing flags of the whole build
+#if defined(__GNUC__)
+#define __TARGET_AVX2__ __attribute__((target("avx2,fma")))
+#define __TARGET_AVX512__ __attribute__((target("avx512f")))
+#else
+#define __TARGET_AVX2__
+#define __TARGET_AVX512__
+#endif
+
+// Version of kernels in use, the widest supported one unless it is set
+static SimdType selectedSimdType = VectorKernels::detectSimdType();
+
+/**
+ * @brief Multiplies the matrix by the vector row by row.
+ *
+ * @param t_matrix conductance matrix.
+ * @param t_vector vector to multiply.
+ * @param t_result result of multiplication.
+ */
+static void multiplyScalar(const ConductanceMatrix& t_matrix, const Value* t_vector, Value* t_result)
+{
+    for (uint64_t row {}; row < t_matrix.size(); ++row) {
+        Value sumOfNodes {};
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k)
+            sumOfNodes += t_matrix.conductances[k] * t_vector[t_matrix.columnIndices[k]];
+
+        t_result[row] = t_matrix.diagonal[row] * t_vector[row] - sumOfNodes;
+    }
+}
+
+/**
+ * @brief Relaxes rows of the slices one by one.
+ *
+ * @param t_matrix conductance matrix.
+ * @param t_state currents and values of the rows.
+ * @param t_sliceBegin first slice.
+ * @param t_sliceEnd slice after the last one.
+ * @param t_precision max change of the row value to count it as solved.
+ * @return uint64_t - number of solved rows.
+ */
+static uint64_t relaxSlicesScalar(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+    const uint64_t& t_sliceBegin, const uint64_t& t_sliceEnd, const Value& t_precision)
+{
+    uint64_t totalRowsSolved {};
+    auto& values = t_state.values;
+    const auto& currents = t_state.currents;
+
+    for (uint64_t i = t_matrix.sliceRowOffsets[t_sliceBegin]; i < t_matrix.sliceRowOffsets[t_sliceEnd]; ++i) {
+        uint64_t row = t_matrix.colorRows[i];
+        Value sumOfNodes = t_matrix.fixedCurrents[row];
+
+        for (uint64_t k = t_matrix.rowOffsets[row]; k < t_matrix.rowOffsets[row + 1]; ++k)
+            sumOfNodes += t_matrix.conductances[k] * values[t_matrix.columnIndices[k]];
+
+        Value previousValue = values[row];
+        values[row] = (sumOfNodes - currents[row]) * t_matrix.inverseDiagonal[row];
+
+        if (std::fabs(values[row] - previousValue) < t_precision)
+            ++totalRowsSolved;
+    }
+
+    return totalRowsSolved;
+}
+
+/**
+ * @brief Arrays of one line of the lattice, coefficients are null when cells of the line have no such neighbors.
+ *
+ */
+struct StencilLine {
+    Value* values {};
+    const Value* couplings {};
+    const Value* inverseDiagonal {};
+    const Value* east {};
+    const Value* south {};
+    const Value* north {};
+    uint64_t width {};
+    uint64_t y {};
+};
+
+/**
+ * @brief Relaxes cells of one color in a part of the line of the lattice one by one.
+ *
+ * @param t_line arrays of the line.
+ * @param t_xBegin first cell of the part.
+ * @param t_xEnd cell after the last one.
+ * @param t_color color of the cells, parity of x + y.
+ * @param t_precision max change of the row value to count it as solved.
+ * @return uint64_t - number of solved rows.
+ */
+static uint64_t relaxStencilCells(const StencilLine& t_line, const uint64_t& t_xBegin, const uint64_t& t_xEnd,
+    const uint64_t& t_color, const Value& t_precision)
+{
+    uint64_t totalRowsSolved {};
+    Value* values = t_line.values;
+
+    for (uint64_t x = t_xBegin + ((t_xBegin + t_line.y + t_color) & 1); x < t_xEnd; x += 2) {
+        Value sumOfNodes = t_line.couplings[x];
+
+        if (t_line.east && x > 0)
+            sumOfNodes += t_line.east[x - 1] * values[x - 1];
+
+        if (t_line.east && x + 1 < t_line.width)
+            sumOfNodes += t_line.east[x] * values[x + 1];
+
+        if (t_line.south)
+            sumOfNodes += t_line.south[x] * values[x - t_line.width];
+
+        if (t_line.north)
+            sumOfNodes += t_line.north[x] * values[x + t_line.width];
+
+        Value previousValue = values[x];
+        values[x] = sumOfNodes * t_line.inverseDiagonal[x];
+
+        if (std::fabs(values[x] - previousValue) < t_precision)
+            ++totalRowsSolved;
+    }
+
+    return totalRowsSolved;
+}
+
+#ifdef __VECTOR_KERNELS_X86__
+
+// =================================================================
+// AVX2 versions, 4 values per vector
+
+__TARGET_AVX2__ static inline Value reduceAddAVX2(const __m256d& t_vector)
+{
+    __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(t_vector), _mm256_extractf128_pd(t_vector, 1));
+
+    return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+__TARGET_AVX2__ static Value dotAVX2(const Value* t_first, const Value* t_second, const uint64_t& t_size)
+{
+    __m256d firstSum = _mm256_setzero_pd();
+    __m256d secondSum = _mm256_setzero_pd();
+    uint64_t i {};
+
+    // Two sums hide the latency of fused multiply-add
+    for (; i + 8 <= t_size; i += 8) {
+        firstSum = _mm256_fmadd_pd(_mm256_loadu_pd(t_first + i), _mm256_loadu_pd(t_second + i), firstSum);
+        secondSum = _mm256_fmadd_pd(_mm256_loadu_pd(t_first + i + 4), _mm256_loadu_pd(t_second + i + 4), secondSum);
+    }
+
+    Value sum = reduceAddAVX2(_mm256_add_pd(firstSum, secondSum));
+
+    for (; i < t_size; ++i)
+        sum += t_first[i] * t_second[i];
+
+    return sum;
+}
+
+__TARGET_AVX2__ static void addScaledAVX2(Value* t_target, const Value* t_source, const Value& t_scale,
+    const uint64_t& t_size)
+{
+    __m256d scale = _mm256_set1_pd(t_scale);
+    uint64_t i {};
+
+    for (; i + 4 <= t_size; i += 4)
+        _mm256_storeu_pd(t_target + i,
+            _mm256_fmadd_pd(scale, _mm256_loadu_pd(t_source + i), _mm256_loadu_pd(t_target + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] += t_scale * t_source[i];
+}
+
+__TARGET_AVX2__ static void scaleAndAddAVX2(Value* t_target, const Value* t_source, const Value& t_scale,
+    const uint64_t& t_size)
+{
+    __m256d scale = _mm256_set1_pd(t_scale);
+    uint64_t i {};
+
+    for (; i + 4 <= t_size; i += 4)
+        _mm256_storeu_pd(t_target + i,
+            _mm256_fmadd_pd(scale, _mm256_loadu_pd(t_target + i), _mm256_loadu_pd(t_source + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] = t_source[i] + t_scale * t_target[i];
+}
+
+__TARGET_AVX2__ static void multiplyElementsAVX2(Value* t_target, const Value* t_first, const Value* t_second,
+    const uint64_t& t_size)
+{
+    uint64_t i {};
+
+    for (; i + 4 <= t_size; i += 4)
+        _mm256_storeu_pd(t_target + i, _mm256_mul_pd(_mm256_loadu_pd(t_first + i), _mm256_loadu_pd(t_second + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] = t_first[i] * t_second[i];
+}
+
+/**
+ * @brief Sums products of conductances and neighbor values of one half of the slice, 4 rows.
+ *
+ * @param t_matrix conductance matrix.
+ * @param t_vector vector of all rows.
+ * @param t_slice index of the slice.
+ * @param t_half half of the slice: 0 or 1.
+ * @param t_sum initial sums of rows.
+ * @return __m256d - sums of rows.
+ */
+__TARGET_AVX2__ static inline __m256d sumSliceAVX2(const ConductanceMatrix& t_matrix, const Value* t_vector,
+    const uint64_t& t_slice, const uint64_t& t_half, __m256d t_sum)
+{
+    const uint64_t end = t_matrix.sliceEntryOffsets[t_slice + 1];
+
+    for (uint64_t k = t_matrix.sliceEntryOffsets[t_slice] + 4 * t_half; k < end; k += ConductanceMatrix::SLICE_ROWS) {
+        __m256i columns = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(t_matrix.sliceColumns.data() + k));
+
+        t_sum = _mm256_fmadd_pd(_mm256_loadu_pd(t_matrix.sliceConductances.data() + k),
+            _mm256_i64gather_pd(t_vector, columns, 8), t_sum);
+    }
+
+    return t_sum;
+}
+
+__TARGET_AVX2__ static void multiplyAVX2(const ConductanceMatrix& t_matrix, const Value* t_vector, Value* t_result)
+{
+    const uint64_t slicesSize = t_matrix.sliceEntryOffsets.size() - 1;
+    alignas(32) Value products[4];
+
+    for (uint64_t slice {}; slice < slicesSize; ++slice) {
+        const uint64_t lanes = t_matrix.sliceRowOffsets[slice + 1] - t_matrix.sliceRowOffsets[slice];
+        const uint64_t* sliceRows = t_matrix.sliceRows.data() + slice * ConductanceMatrix::SLICE_ROWS;
+
+        for (uint64_t half {}; half < 2 && 4 * half < lanes; ++half) {
+            __m256i rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sliceRows + 4 * half));
+            __m256d sum = sumSliceAVX2(t_matrix, t_vector, slice, half, _mm256_setzero_pd());
+
+            _mm256_store_pd(products,
+                _mm256_fmsub_pd(_mm256_i64gather_pd(t_matrix.diagonal.data(), rows, 8),
+                    _mm256_i64gather_pd(t_vector, rows, 8), sum));
+
+            // AVX2 has no scatter, rows are stored one by one
+            for (uint64_t lane {}; lane < 4 && 4 * half + lane < lanes; ++lane)
+                t_result[sliceRows[4 * half + lane]] = products[lane];
+        }
+    }
+}
+
+__TARGET_AVX2__ static uint64_t relaxSlicesAVX2(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+    const uint64_t& t_sliceBegin, const uint64_t& t_sliceEnd, const Value& t_precision)
+{
+    const __m256d signBit = _mm256_set1_pd(-0.0);
+    const __m256d precision = _mm256_set1_pd(t_precision);
+    Value* values = t_state.values.data();
+    uint64_t totalRowsSolved {};
+    alignas(32) Value rowValues[4];
+
+    for (uint64_t slice = t_sliceBegin; slice < t_sliceEnd; ++slice) {
+        const uint64_t lanes = t_matrix.sliceRowOffsets[slice + 1] - t_matrix.sliceRowOffsets[slice];
+        const uint64_t* sliceRows = t_matrix.sliceRows.data() + slice * ConductanceMatrix::SLICE_ROWS;
+
+        for (uint64_t half {}; half < 2 && 4 * half < lanes; ++half) {
+            __m256i rows = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(sliceRows + 4 * half));
+            __m256d sum = sumSliceAVX2(t_matrix, values, slice, half,
+                _mm256_i64gather_pd(t_matrix.fixedCurrents.data(), rows, 8));
+            __m256d previousValue = _mm256_i64gather_pd(values, rows, 8);
+            __m256d value = _mm256_mul_pd(_mm256_sub_pd(sum, _mm256_i64gather_pd(t_state.currents.data(), rows, 8)),
+                _mm256_i64gather_pd(t_matrix.inverseDiagonal.data(), rows, 8));
+            __m256d change = _mm256_andnot_pd(signBit, _mm256_sub_pd(value, previousValue));
+            int isSolved = _mm256_movemask_pd(_mm256_cmp_pd(change, precision, _CMP_LT_OQ));
+
+            _mm256_store_pd(rowValues, value);
+
+            for (uint64_t lane {}; lane < 4 && 4 * half + lane < lanes; ++lane) {
+                values[sliceRows[4 * half + lane]] = rowValues[lane];
+                totalRowsSolved += (isSolved >> lane) & 1;
+            }
+        }
+    }
+
+    return totalRowsSolved;
+}
+
+/**
+ * @brief Loads flags of 4 nodes and marks nodes without skipped flags.
+ *
+ * @param t_flags flags of the first node.
+ * @param t_skippedFlags skipped flags in every lane.
+ * @return __m256d - all bits set in lanes of kept nodes.
+ */
+__TARGET_AVX2__ static inline __m256d keptNodesAVX2(const uint8_t* t_flags, const __m256i& t_skippedFlags)
+{
+    int32_t packedFlags {};
+    std::memcpy(&packedFlags, t_flags, sizeof(packedFlags));
+
+    __m256i flags = _mm256_cvtepu8_epi64(_mm_cvtsi32_si128(packedFlags));
+
+    return _mm256_castsi256_pd(_mm256_cmpeq_epi64(_mm256_and_si256(flags, t_skippedFlags), _mm256_setzero_si256()));
+}
+
+__TARGET_AVX2__ static std::array<Value, 3> calculateIRDropAVX2(const Value* t_values, const uint8_t* t_flags,
+    const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size)
+{
+    const __m256i skippedFlags = _mm256_set1_epi64x(t_skippedFlags);
+    const __m256d voltage = _mm256_set1_pd(t_voltage);
+    __m256d maxDrop = _mm256_setzero_pd();
+    __m256d minDrop = voltage;
+    __m256d sumOfDrops = _mm256_setzero_pd();
+    uint64_t i {};
+
+    for (; i + 4 <= t_size; i += 4) {
+        __m256d isKept = keptNodesAVX2(t_flags + i, skippedFlags);
+        __m256d drop = _mm256_sub_pd(voltage, _mm256_loadu_pd(t_values + i));
+
+        maxDrop = _mm256_blendv_pd(maxDrop, _mm256_max_pd(maxDrop, drop), isKept);
+        minDrop = _mm256_blendv_pd(minDrop, _mm256_min_pd(minDrop, drop), isKept);
+        sumOfDrops = _mm256_add_pd(sumOfDrops, _mm256_and_pd(drop, isKept));
+    }
+
+    alignas(32) Value maxDrops[4];
+    alignas(32) Value minDrops[4];
+    _mm256_store_pd(maxDrops, maxDrop);
+    _mm256_store_pd(minDrops, minDrop);
+
+    std::array<Value, 3> irDropValues { *std::max_element(maxDrops, maxDrops + 4),
+        *std::min_element(minDrops, minDrops + 4), reduceAddAVX2(sumOfDrops) };
+
+    for (; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            Value drop = t_voltage - t_values[i];
+
+            irDropValues[0] = std::max(irDropValues[0], drop);
+            irDropValues[1] = std::min(irDropValues[1], drop);
+            irDropValues[2] += drop;
+        }
+    }
+
+    return irDropValues;
+}
+
+__TARGET_AVX2__ static Value sumRelativeDifferencesAVX2(const Value* t_values, const Value* t_realValues,
+    const uint8_t* t_flags, const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size,
+    uint64_t& t_count)
+{
+    const __m256i skippedFlags = _mm256_set1_epi64x(t_skippedFlags);
+    const __m256d voltage = _mm256_set1_pd(t_voltage);
+    const __m256d signBit = _mm256_set1_pd(-0.0);
+    __m256d sumOfDifferences = _mm256_setzero_pd();
+    uint64_t i {};
+
+    t_count = 0;
+
+    for (; i + 4 <= t_size; i += 4) {
+        __m256d isKept = keptNodesAVX2(t_flags + i, skippedFlags);
+        __m256d realValue = _mm256_loadu_pd(t_realValues + i);
+        __m256d difference = _mm256_div_pd(_mm256_sub_pd(realValue, _mm256_loadu_pd(t_values + i)),
+            _mm256_sub_pd(voltage, realValue));
+
+        // Skipped lanes may divide by zero, their bits are cleared before the sum
+        difference = _mm256_and_pd(_mm256_andnot_pd(signBit, difference), isKept);
+        sumOfDifferences = _mm256_add_pd(sumOfDifferences, difference);
+        t_count += std::bitset<4>(_mm256_movemask_pd(isKept)).count();
+    }
+
+    Value sum = reduceAddAVX2(sumOfDifferences);
+
+    for (; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            sum += std::fabs((t_realValues[i] - t_values[i]) / (t_voltage - t_realValues[i]));
+            ++t_count;
+        }
+    }
+
+    return sum;
+}
+
+__TARGET_AVX2__ static uint64_t relaxStencilLineAVX2(const StencilLine& t_line, const uint64_t& t_color,
+    const Value& t_precision)
+{
+    const uint64_t width = t_line.width;
+    // Vector stores may alias any memory, so arrays are read once into locals
+    Value* values = t_line.values;
+    const Value* couplings = t_line.couplings;
+    const Value* inverseDiagonal = t_line.inverseDiagonal;
+    const Value* east = t_line.east;
+    const Value* south = t_line.south;
+    const Value* north = t_line.north;
+    const __m256d precision = _mm256_set1_pd(t_precision);
+    const __m256d signBit = _mm256_set1_pd(-0.0);
+
+    // Cells at both ends of the line have one neighbor in the line
+    uint64_t totalRowsSolved = relaxStencilCells(t_line, 0, 1, t_color, t_precision);
+
+    // Lanes of the color alternate and blocks are of even size, so the mask is the same along the line
+    const __m256d isColor = ((1 + t_line.y + t_color) & 1) == 0
+        ? _mm256_castsi256_pd(_mm256_set_epi64x(0, -1, 0, -1))
+        : _mm256_castsi256_pd(_mm256_set_epi64x(-1, 0, -1, 0));
+    __m256d relaxedValue = _mm256_setzero_pd();
+    uint64_t x = 1;
+
+    for (; x + 5 <= width; x += 4) {
+        __m256d sumOfNodes = _mm256_loadu_pd(couplings + x);
+
+        if (east) {
+            sumOfNodes = _mm256_fmadd_pd(_mm256_loadu_pd(east + x - 1), _mm256_loadu_pd(values + x - 1),
+                sumOfNodes);
+            sumOfNodes = _mm256_fmadd_pd(_mm256_loadu_pd(east + x), _mm256_loadu_pd(values + x + 1),
+                sumOfNodes);
+        }
+
+        if (south)
+            sumOfNodes = _mm256_fmadd_pd(_mm256_loadu_pd(south + x), _mm256_loadu_pd(values + x - width),
+                sumOfNodes);
+
+        if (north)
+            sumOfNodes = _mm256_fmadd_pd(_mm256_loadu_pd(north + x), _mm256_loadu_pd(values + x + width),
+                sumOfNodes);
+
+        // The previous block is stored after loads of this one overlapping it, so loads never wait for the store
+        if (x > 1)
+            _mm256_storeu_pd(values + x - 4, relaxedValue);
+
+        __m256d previousValue = _mm256_loadu_pd(values + x);
+        __m256d value = _mm256_mul_pd(sumOfNodes, _mm256_loadu_pd(inverseDiagonal + x));
+        relaxedValue = _mm256_blendv_pd(previousValue, value, isColor);
+
+        __m256d change = _mm256_andnot_pd(signBit, _mm256_sub_pd(value, previousValue));
+        __m256d isSolved = _mm256_and_pd(_mm256_cmp_pd(change, precision, _CMP_LT_OQ), isColor);
+        totalRowsSolved += std::bitset<4>(_mm256_movemask_pd(isSolved)).count();
+    }
+
+    if (x > 1)
+        _mm256_storeu_pd(values + x - 4, relaxedValue);
+
+    return totalRowsSolved + relaxStencilCells(t_line, x, width, t_color, t_precision);
+}
+
+// =================================================================
+// AVX-512 versions, 8 values per vector. Masked forms of gathers and conversions are used, plain ones start from an
+// undefined vector which some compilers warn about
+
+/**
+ * @brief Sums lanes of the vector.
+ *
+ * @param t_vector vector to sum.
+ * @return Value - sum of lanes.
+ */
+__TARGET_AVX512__ static inline Value reduceAddAVX512(const __m512d& t_vector)
+{
+    alignas(64) Value lanes[8];
+    _mm512_store_pd(lanes, t_vector);
+
+    return std::accumulate(lanes, lanes + 8, Value {});
+}
+
+__TARGET_AVX512__ static Value dotAVX512(const Value* t_first, const Value* t_second, const uint64_t& t_size)
+{
+    __m512d firstSum = _mm512_setzero_pd();
+    __m512d secondSum = _mm512_setzero_pd();
+    uint64_t i {};
+
+    for (; i + 16 <= t_size; i += 16) {
+        firstSum = _mm512_fmadd_pd(_mm512_loadu_pd(t_first + i), _mm512_loadu_pd(t_second + i), firstSum);
+        secondSum = _mm512_fmadd_pd(_mm512_loadu_pd(t_first + i + 8), _mm512_loadu_pd(t_second + i + 8), secondSum);
+    }
+
+    Value sum = reduceAddAVX512(_mm512_add_pd(firstSum, secondSum));
+
+    for (; i < t_size; ++i)
+        sum += t_first[i] * t_second[i];
+
+    return sum;
+}
+
+__TARGET_AVX512__ static void addScaledAVX512(Value* t_target, const Value* t_source, const Value& t_scale,
+    const uint64_t& t_size)
+{
+    __m512d scale = _mm512_set1_pd(t_scale);
+    uint64_t i {};
+
+    for (; i + 8 <= t_size; i += 8)
+        _mm512_storeu_pd(t_target + i,
+            _mm512_fmadd_pd(scale, _mm512_loadu_pd(t_source + i), _mm512_loadu_pd(t_target + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] += t_scale * t_source[i];
+}
+
+__TARGET_AVX512__ static void scaleAndAddAVX512(Value* t_target, const Value* t_source, const Value& t_scale,
+    const uint64_t& t_size)
+{
+    __m512d scale = _mm512_set1_pd(t_scale);
+    uint64_t i {};
+
+    for (; i + 8 <= t_size; i += 8)
+        _mm512_storeu_pd(t_target + i,
+            _mm512_fmadd_pd(scale, _mm512_loadu_pd(t_target + i), _mm512_loadu_pd(t_source + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] = t_source[i] + t_scale * t_target[i];
+}
+
+__TARGET_AVX512__ static void multiplyElementsAVX512(Value* t_target, const Value* t_first, const Value* t_second,
+    const uint64_t& t_size)
+{
+    uint64_t i {};
+
+    for (; i + 8 <= t_size; i += 8)
+        _mm512_storeu_pd(t_target + i, _mm512_mul_pd(_mm512_loadu_pd(t_first + i), _mm512_loadu_pd(t_second + i)));
+
+    for (; i < t_size; ++i)
+        t_target[i] = t_first[i] * t_second[i];
+}
+
+/**
+ * @brief Gathers values at 8 indices.
+ *
+ * @param t_values array to gather from.
+ * @param t_indices indices of values.
+ * @return __m512d - gathered values.
+ */
+__TARGET_AVX512__ static inline __m512d gatherAVX512(const Value* t_values, const __m512i& t_indices)
+{
+    return _mm512_mask_i64gather_pd(_mm512_setzero_pd(), 0xFF, t_indices, t_values, 8);
+}
+
+/**
+ * @brief Sums products of conductances and neighbor values of rows of the slice.
+ *
+ * @param t_matrix conductance matrix.
+ * @param t_vector vector of all rows.
+ * @param t_slice index of the slice.
+ * @param t_sum initial sums of rows.
+ * @return __m512d - sums of rows.
+ */
+__TARGET_AVX512__ static inline __m512d sumSliceAVX512(const ConductanceMatrix& t_matrix, const Value* t_vector,
+    const uint64_t& t_slice, __m512d t_sum)
+{
+    const uint64_t end = t_matrix.sliceEntryOffsets[t_slice + 1];
+
+    for (uint64_t k = t_matrix.sliceEntryOffsets[t_slice]; k < end; k += ConductanceMatrix::SLICE_ROWS) {
+        t_sum = _mm512_fmadd_pd(_mm512_loadu_pd(t_matrix.sliceConductances.data() + k),
+            gatherAVX512(t_vector, _mm512_loadu_si512(t_matrix.sliceColumns.data() + k)), t_sum);
+    }
+
+    return t_sum;
+}
+
+__TARGET_AVX512__ static void multiplyAVX512(const ConductanceMatrix& t_matrix, const Value* t_vector, Value* t_result)
+{
+    const uint64_t slicesSize = t_matrix.sliceEntryOffsets.size() - 1;
+
+    for (uint64_t slice {}; slice < slicesSize; ++slice) {
+        const uint64_t lanes = t_matrix.sliceRowOffsets[slice + 1] - t_matrix.sliceRowOffsets[slice];
+        __mmask8 isRow = static_cast<__mmask8>((1U << lanes) - 1);
+        __m512i rows = _mm512_loadu_si512(t_matrix.sliceRows.data() + slice * ConductanceMatrix::SLICE_ROWS);
+        __m512d sum = sumSliceAVX512(t_matrix, t_vector, slice, _mm512_setzero_pd());
+
+        _mm512_mask_i64scatter_pd(t_result, isRow, rows,
+            _mm512_fmsub_pd(gatherAVX512(t_matrix.diagonal.data(), rows), gatherAVX512(t_vector, rows), sum), 8);
+    }
+}
+
+__TARGET_AVX512__ static uint64_t relaxSlicesAVX512(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+    const uint64_t& t_sliceBegin, const uint64_t& t_sliceEnd, const Value& t_precision)
+{
+    const __m512d precision = _mm512_set1_pd(t_precision);
+    Value* values = t_state.values.data();
+    uint64_t totalRowsSolved {};
+
+    for (uint64_t slice = t_sliceBegin; slice < t_sliceEnd; ++slice) {
+        const uint64_t lanes = t_matrix.sliceRowOffsets[slice + 1] - t_matrix.sliceRowOffsets[slice];
+        __mmask8 isRow = static_cast<__mmask8>((1U << lanes) - 1);
+        __m512i rows = _mm512_loadu_si512(t_matrix.sliceRows.data() + slice * ConductanceMatrix::SLICE_ROWS);
+        __m512d sum = sumSliceAVX512(t_matrix, values, slice, gatherAVX512(t_matrix.fixedCurrents.data(), rows));
+        __m512d previousValue = gatherAVX512(values, rows);
+        __m512d value = _mm512_mul_pd(_mm512_sub_pd(sum, gatherAVX512(t_state.currents.data(), rows)),
+            gatherAVX512(t_matrix.inverseDiagonal.data(), rows));
+
+        _mm512_mask_i64scatter_pd(values, isRow, rows, value, 8);
+        totalRowsSolved += std::bitset<8>(
+            _mm512_mask_cmp_pd_mask(isRow, _mm512_abs_pd(_mm512_sub_pd(value, previousValue)), precision, _CMP_LT_OQ))
+                               .count();
+    }
+
+    return totalRowsSolved;
+}
+
+/**
+ * @brief Loads flags of 8 nodes and marks nodes without skipped flags.
+ *
+ * @param t_flags flags of the first node.
+ * @param t_skippedFlags skipped flags in every lane.
+ * @return __mmask8 - bits of kept nodes.
+ */
+__TARGET_AVX512__ static inline __mmask8 keptNodesAVX512(const uint8_t* t_flags, const __m512i& t_skippedFlags)
+{
+    __m512i flags = _mm512_maskz_cvtepu8_epi64(0xFF, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(t_flags)));
+
+    return _mm512_testn_epi64_mask(flags, t_skippedFlags);
+}
+
+__TARGET_AVX512__ static std::array<Value, 3> calculateIRDropAVX512(const Value* t_values, const uint8_t* t_flags,
+    const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size)
+{
+    const __m512i skippedFlags = _mm512_set1_epi64(t_skippedFlags);
+    const __m512d voltage = _mm512_set1_pd(t_voltage);
+    __m512d maxDrop = _mm512_setzero_pd();
+    __m512d minDrop = voltage;
+    __m512d sumOfDrops = _mm512_setzero_pd();
+    uint64_t i {};
+
+    for (; i + 8 <= t_size; i += 8) {
+        __mmask8 isKept = keptNodesAVX512(t_flags + i, skippedFlags);
+        __m512d drop = _mm512_sub_pd(voltage, _mm512_loadu_pd(t_values + i));
+
+        maxDrop = _mm512_mask_max_pd(maxDrop, isKept, maxDrop, drop);
+        minDrop = _mm512_mask_min_pd(minDrop, isKept, minDrop, drop);
+        sumOfDrops = _mm512_mask_add_pd(sumOfDrops, isKept, sumOfDrops, drop);
+    }
+
+    alignas(64) Value maxDrops[8];
+    alignas(64) Value minDrops[8];
+    _mm512_store_pd(maxDrops, maxDrop);
+    _mm512_store_pd(minDrops, minDrop);
+
+    std::array<Value, 3> irDropValues { *std::max_element(maxDrops, maxDrops + 8),
+        *std::min_element(minDrops, minDrops + 8), reduceAddAVX512(sumOfDrops) };
+
+    for (; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            Value drop = t_voltage - t_values[i];
+
+            irDropValues[0] = std::max(irDropValues[0], drop);
+            irDropValues[1] = std::min(irDropValues[1], drop);
+            irDropValues[2] += drop;
+        }
+    }
+
+    return irDropValues;
+}
+
+__TARGET_AVX512__ static Value sumRelativeDifferencesAVX512(const Value* t_values, const Value* t_realValues,
+    const uint8_t* t_flags, const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size,
+    uint64_t& t_count)
+{
+    const __m512i skippedFlags = _mm512_set1_epi64(t_skippedFlags);
+    const __m512d voltage = _mm512_set1_pd(t_voltage);
+    __m512d sumOfDifferences = _mm512_setzero_pd();
+    uint64_t i {};
+
+    t_count = 0;
+
+    for (; i + 8 <= t_size; i += 8) {
+        __mmask8 isKept = keptNodesAVX512(t_flags + i, skippedFlags);
+        __m512d realValue = _mm512_loadu_pd(t_realValues + i);
+        __m512d difference = _mm512_maskz_div_pd(isKept, _mm512_sub_pd(realValue, _mm512_loadu_pd(t_values + i)),
+            _mm512_sub_pd(voltage, realValue));
+
+        sumOfDifferences = _mm512_add_pd(sumOfDifferences, _mm512_abs_pd(difference));
+        t_count += std::bitset<8>(isKept).count();
+    }
+
+    Value sum = reduceAddAVX512(sumOfDifferences);
+
+    for (; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            sum += std::fabs((t_realValues[i] - t_values[i]) / (t_voltage - t_realValues[i]));
+            ++t_count;
+        }
+    }
+
+    return sum;
+}
+
+__TARGET_AVX512__ static uint64_t relaxStencilLineAVX512(const StencilLine& t_line, const uint64_t& t_color,
+    const Value& t_precision)
+{
+    const uint64_t width = t_line.width;
+    // Vector stores may alias any memory, so arrays are read once into locals
+    Value* values = t_line.values;
+    const Value* couplings = t_line.couplings;
+    const Value* inverseDiagonal = t_line.inverseDiagonal;
+    const Value* east = t_line.east;
+    const Value* south = t_line.south;
+    const Value* north = t_line.north;
+    const __m512d precision = _mm512_set1_pd(t_precision);
+
+    // Cells at both ends of the line have one neighbor in the line
+    uint64_t totalRowsSolved = relaxStencilCells(t_line, 0, 1, t_color, t_precision);
+
+    // Lanes of the color alternate and blocks are of even size, so the mask is the same along the line
+    const __mmask8 isColor = ((1 + t_line.y + t_color) & 1) == 0 ? 0x55 : 0xAA;
+    __m512d relaxedValue = _mm512_setzero_pd();
+    uint64_t x = 1;
+
+    for (; x + 9 <= width; x += 8) {
+        __m512d sumOfNodes = _mm512_loadu_pd(couplings + x);
+
+        if (east) {
+            sumOfNodes = _mm512_fmadd_pd(_mm512_loadu_pd(east + x - 1), _mm512_loadu_pd(values + x - 1),
+                sumOfNodes);
+            sumOfNodes = _mm512_fmadd_pd(_mm512_loadu_pd(east + x), _mm512_loadu_pd(values + x + 1),
+                sumOfNodes);
+        }
+
+        if (south)
+            sumOfNodes = _mm512_fmadd_pd(_mm512_loadu_pd(south + x), _mm512_loadu_pd(values + x - width),
+                sumOfNodes);
+
+        if (north)
+            sumOfNodes = _mm512_fmadd_pd(_mm512_loadu_pd(north + x), _mm512_loadu_pd(values + x + width),
+                sumOfNodes);
+
+        // The previous block is stored after loads of this one overlapping it, so loads never wait for the store
+        if (x > 1)
+            _mm512_storeu_pd(values + x - 8, relaxedValue);
+
+        __m512d previousValue = _mm512_loadu_pd(values + x);
+        __m512d value = _mm512_mul_pd(sumOfNodes, _mm512_loadu_pd(inverseDiagonal + x));
+        relaxedValue = _mm512_mask_blend_pd(isColor, previousValue, value);
+
+        __m512d change = _mm512_abs_pd(_mm512_sub_pd(value, previousValue));
+        totalRowsSolved += std::bitset<8>(_mm512_mask_cmp_pd_mask(isColor, change, precision, _CMP_LT_OQ)).count();
+    }
+
+    if (x > 1)
+        _mm512_storeu_pd(values + x - 8, relaxedValue);
+
+    return totalRowsSolved + relaxStencilCells(t_line, x, width, t_color, t_precision);
+}
+
+#endif
+
+SimdType VectorKernels::detectSimdType()
+{
+#if defined(__VECTOR_KERNELS_X86__) && defined(_MSC_VER)
+    int info[4] {};
+    __cpuid(info, 0);
+
+    if (info[0] < 7)
+        return SimdType::Scalar;
+
+    __cpuid(info, 1);
+    bool isFma = (info[2] & (1 << 12)) != 0;
+
+    // Wide registers must also be saved by the system
+    if ((info[2] & (1 << 27)) == 0)
+        return SimdType::Scalar;
+
+    uint64_t savedRegisters = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+
+    if ((info[1] & (1 << 16)) != 0 && (savedRegisters & 0xE6) == 0xE6)
+        return SimdType::AVX512;
+
+    if ((info[1] & (1 << 5)) != 0 && isFma && (savedRegisters & 0x6) == 0x6)
+        return SimdType::AVX2;
+#elif defined(__VECTOR_KERNELS_X86__) && defined(__GNUC__)
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f"))
+        return SimdType::AVX512;
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return SimdType::AVX2;
+#endif
+
+    return SimdType::Scalar;
+}
+
+SimdType VectorKernels::getSimdType()
+{
+    return selectedSimdType;
+}
+
+void VectorKernels::setSimdType(const SimdType& t_simdType)
+{
+    if (static_cast<int>(t_simdType) > static_cast<int>(detectSimdType()))
+        throw std::invalid_argument(std::string("SIMD is not supported by the cpu: ") + getSimdName(t_simdType));
+
+    selectedSimdType = t_simdType;
+}
+
+void VectorKernels::setSimd(const std::string& t_simd)
+{
+    if (t_simd == "auto")
+        setSimdType(detectSimdType());
+    else if (t_simd == "scalar")
+        setSimdType(SimdType::Scalar);
+    else if (t_simd == "avx2")
+        setSimdType(SimdType::AVX2);
+    else if (t_simd == "avx512")
+        setSimdType(SimdType::AVX512);
+    else
+        throw std::invalid_argument(std::string("Unknown SIMD: ") + t_simd);
+}
+
+std::string VectorKernels::getSimdName(const SimdType& t_simdType)
+{
+    switch (t_simdType) {
+    case SimdType::AVX2:
+        return "avx2";
+    case SimdType::AVX512:
+        return "avx512";
+    default:
+        return "scalar";
+    }
+}
+
+Value VectorKernels::dot(const Value* t_first, const Value* t_second, const uint64_t& t_size)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return dotAVX512(t_first, t_second, t_size);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return dotAVX2(t_first, t_second, t_size);
+#endif
+
+    return std::inner_product(t_first, t_first + t_size, t_second, Value {});
+}
+
+void VectorKernels::addScaled(Value* t_target, const Value* t_source, const Value& t_scale, const uint64_t& t_size)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return addScaledAVX512(t_target, t_source, t_scale, t_size);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return addScaledAVX2(t_target, t_source, t_scale, t_size);
+#endif
+
+    for (uint64_t i {}; i < t_size; ++i)
+        t_target[i] += t_scale * t_source[i];
+}
+
+void VectorKernels::scaleAndAdd(Value* t_target, const Value* t_source, const Value& t_scale, const uint64_t& t_size)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return scaleAndAddAVX512(t_target, t_source, t_scale, t_size);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return scaleAndAddAVX2(t_target, t_source, t_scale, t_size);
+#endif
+
+    for (uint64_t i {}; i < t_size; ++i)
+        t_target[i] = t_source[i] + t_scale * t_target[i];
+}
+
+void VectorKernels::multiplyElements(Value* t_target, const Value* t_first, const Value* t_second,
+    const uint64_t& t_size)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return multiplyElementsAVX512(t_target, t_first, t_second, t_size);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return multiplyElementsAVX2(t_target, t_first, t_second, t_size);
+#endif
+
+    for (uint64_t i {}; i < t_size; ++i)
+        t_target[i] = t_first[i] * t_second[i];
+}
+
+void VectorKernels::multiply(const ConductanceMatrix& t_matrix, const Value* t_vector, Value* t_result)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return multiplyAVX512(t_matrix, t_vector, t_result);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return multiplyAVX2(t_matrix, t_vector, t_result);
+#endif
+
+    multiplyScalar(t_matrix, t_vector, t_result);
+}
+
+uint64_t VectorKernels::relaxSlices(const ConductanceMatrix& t_matrix, ConductanceState& t_state,
+    const uint64_t& t_sliceBegin, const uint64_t& t_sliceEnd, const Value& t_precision)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return relaxSlicesAVX512(t_matrix, t_state, t_sliceBegin, t_sliceEnd, t_precision);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return relaxSlicesAVX2(t_matrix, t_state, t_sliceBegin, t_sliceEnd, t_precision);
+#endif
+
+    return relaxSlicesScalar(t_matrix, t_state, t_sliceBegin, t_sliceEnd, t_precision);
+}
+
+uint64_t VectorKernels::relaxStencilLine(const StencilRegion& t_region, const ConductanceMatrix& t_matrix,
+    ConductanceState& t_state, const Value* t_couplings, const uint64_t& t_y, const uint64_t& t_color,
+    const Value& t_precision)
+{
+    const uint64_t offset = t_y * t_region.width;
+    StencilLine line {};
+
+    line.values = t_state.values.data() + t_region.firstRow + offset;
+    line.couplings = t_couplings + offset;
+    line.inverseDiagonal = t_matrix.inverseDiagonal.data() + t_region.firstRow + offset;
+    line.width = t_region.width;
+    line.y = t_y;
+
+    if (!t_region.eastConductances.empty())
+        line.east = t_region.eastConductances.data() + offset;
+
+    if (!t_region.northConductances.empty() && t_y > 0)
+        line.south = t_region.northConductances.data() + offset - t_region.width;
+
+    if (!t_region.northConductances.empty() && t_y + 1 < t_region.height)
+        line.north = t_region.northConductances.data() + offset;
+
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return relaxStencilLineAVX512(line, t_color, t_precision);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return relaxStencilLineAVX2(line, t_color, t_precision);
+#endif
+
+    return relaxStencilCells(line, 0, line.width, t_color, t_precision);
+}
+
+std::array<Value, 3> VectorKernels::calculateIRDrop(const Value* t_values, const uint8_t* t_flags,
+    const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return calculateIRDropAVX512(t_values, t_flags, t_skippedFlags, t_voltage, t_size);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return calculateIRDropAVX2(t_values, t_flags, t_skippedFlags, t_voltage, t_size);
+#endif
+
+    std::array<Value, 3> irDropValues { 0, t_voltage, 0 };
+
+    for (uint64_t i {}; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            Value drop = t_voltage - t_values[i];
+
+            irDropValues[0] = std::max(irDropValues[0], drop);
+            irDropValues[1] = std::min(irDropValues[1], drop);
+            irDropValues[2] += drop;
+        }
+    }
+
+    return irDropValues;
+}
+
+Value VectorKernels::sumRelativeDifferences(const Value* t_values, const Value* t_realValues, const uint8_t* t_flags,
+    const uint8_t& t_skippedFlags, const Value& t_voltage, const uint64_t& t_size, uint64_t& t_count)
+{
+#ifdef __VECTOR_KERNELS_X86__
+    if (selectedSimdType == SimdType::AVX512)
+        return sumRelativeDifferencesAVX512(t_values, t_realValues, t_flags, t_skippedFlags, t_voltage, t_size,
+            t_count);
+
+    if (selectedSimdType == SimdType::AVX2)
+        return sumRelativeDifferencesAVX2(t_values, t_realValues, t_flags, t_skippedFlags, t_voltage, t_size,
+            t_count);
+#endif
+
+    Value sum {};
+    t_count = 0;
+
+    for (uint64_t i {}; i < t_size; ++i) {
+        if ((t_flags[i] & t_skippedFlags) == 0) {
+            sum += std::fabs((t_realValues[i] - t_values[i]) / (t_voltage - t_realValues[i]));
+            ++t_count;
+        }
+    }
+
+    return sum;
+}
@@ -3,6 +3,7 @@
 #include <sstream>
 
 // Project libs
+#include "../include/buffered_writer.h"
 #include "../include/voltage_source.h"
 
 VoltageSource::VoltageSource(const NodeCoords& t_firstNode, const Value& t_value, const Name& t_name)
@@ -23,7 +24,9 @@ std::string VoltageSource::toString()
     return withoutNameDescription.str();
 }
 
-void VoltageSource::fullyDisconnection()
+void VoltageSource::write(BufferedWriter& t_writer) const
 {
-    connectedNode = nullptr;
-};
\ No newline at end of file
+    t_writer.writeNodeName({ m_layer, m_x, m_y });
+    t_writer.write(std::string_view(" 0 "));
+    t_writer.writeFixed(value, 9);
+}
\ No newline at end of file